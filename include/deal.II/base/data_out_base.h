@@ -29,6 +29,7 @@
 
 // To be able to serialize XDMFEntry
 #include <boost/serialization/map.hpp>
+#include <boost/serialization/version.hpp>
 
 #include <limits>
 #include <ostream>
@@ -1080,8 +1081,74 @@ namespace DataOutBase
      */
     DataOutBase::CompressionLevel compression_level;
 
+    /**
+     * The maximal number of nodes or cells that are stored together in one
+     * chunk of a compressed dataset. HDF5 compresses each chunk separately,
+     * so chunks that are much smaller than the dataset allow the processes
+     * of a parallel write to work on different chunks, and they are also
+     * needed because a single chunk can not exceed 4 GB. The default value
+     * zero selects chunks of about one megabyte. This flag is only used if
+     * compression is enabled.
+     */
+    std::uint64_t chunk_size;
+
+    /**
+     * Whether to apply the shuffle filter of HDF5 before compressing a
+     * dataset. The filter reorders the bytes of the floating point numbers
+     * so that bytes of the same significance are stored next to each other,
+     * which usually improves the compression ratio of simulation data
+     * considerably at little cost. This flag is only used if compression is
+     * enabled.
+     */
+    bool shuffle;
+
+    /**
+     * The name of an HDF5 group in which the solution datasets are stored.
+     * If empty (the default), the datasets are stored at the root of the
+     * solution file, and an existing solution file is overwritten.
+     * Otherwise, an existing solution file is opened and the datasets are
+     * added to the given group, which replaces a group of the same name. This
+     * allows to store all time steps of a simulation in one file, while the
+     * mesh is only written to its own file when it changes:
+     * @code
+     * DataOutBase::Hdf5Flags flags;
+     * flags.solution_group = "step_" + Utilities::int_to_string(step, 5);
+     * data_out.set_flags(flags);
+     *
+     * data_out.write_hdf5_parallel(data_filter,
+     *                              mesh_changed,
+     *                              mesh_filename,
+     *                              "solution.h5",
+     *                              MPI_COMM_WORLD);
+     * xdmf_entries.push_back(data_out.create_xdmf_entry(
+     *   data_filter, mesh_filename, "solution.h5", time, MPI_COMM_WORLD));
+     * data_out.write_xdmf_file(xdmf_entries, "solution.xdmf", MPI_COMM_WORLD);
+     * @endcode
+     * DataOutInterface::create_xdmf_entry() uses the group of the flags set
+     * for the DataOutInterface object to reference the datasets.
+     *
+     * @note Replacing a group only unlinks the old group from the file.
+     * HDF5 does not reclaim the space the old datasets occupied, so a file
+     * into which the same group is written repeatedly keeps growing. Tools
+     * like h5repack can be used to compact such a file.
+     */
+    std::string solution_group;
+
+    /**
+     * Constructor.
+     */
     explicit Hdf5Flags(
-      const CompressionLevel compression_level = CompressionLevel::best_speed);
+      const CompressionLevel compression_level = CompressionLevel::best_speed,
+      const std::uint64_t    chunk_size        = 0,
+      const bool             shuffle           = true,
+      const std::string     &solution_group    = "");
+
+    /**
+     * Return an estimate for the memory consumption, in bytes, of this
+     * object.
+     */
+    std::size_t
+    memory_consumption() const;
   };
 
   /**
@@ -1205,6 +1272,23 @@ namespace DataOutBase
      */
     std::map<std::string, std::string> physical_units;
 
+    /**
+     * A map that describes for (some or all) of the output quantities how
+     * many bits of the mantissa of the single precision numbers written to
+     * the file are kept. The remaining bits are rounded off and set to zero,
+     * which does not change the file format, but allows the compression
+     * selected by @p compression_level to shrink the data considerably. For
+     * example, a value of 10 keeps the precision of a half precision number,
+     * i.e., a relative accuracy of about $10^{-3}$, which is often enough for
+     * monitoring a simulation. Quantities not listed in the map are written
+     * with full single precision, which corresponds to 23 bits. As for
+     * @p physical_units, vector and tensor fields are looked up via their
+     * name or, if they do not have one, the name of their first component.
+     *
+     * This field is only used for the VTU file format.
+     */
+    std::map<std::string, unsigned int> significant_bits;
+
     /**
      * Constructor. Initializes the member variables with names corresponding
      * to the argument names of this function.
@@ -1215,7 +1299,8 @@ namespace DataOutBase
       const bool             print_date_and_time = true,
       const CompressionLevel compression_level   = CompressionLevel::best_speed,
       const bool             write_higher_order_cells          = false,
-      const std::map<std::string, std::string> &physical_units = {});
+      const std::map<std::string, std::string> &physical_units = {},
+      const std::map<std::string, unsigned int> &significant_bits = {});
   };
 
 
@@ -1292,6 +1377,55 @@ namespace DataOutBase
     static const unsigned int format_version;
   };
 
+  /**
+   * A structure holding statistics of one of the output quantities of a
+   * set of patches, as computed by compute_field_statistics().
+   *
+   * @ingroup output
+   */
+  struct FieldStatistics
+  {
+    /**
+     * The name of the quantity.
+     */
+    std::string name;
+
+    /**
+     * The total number of output points over all processes.
+     */
+    std::uint64_t n_points = 0;
+
+    /**
+     * The number of output points at which the quantity is not a finite
+     * number, i.e., NaN or infinite. These points are not taken into account
+     * for the minimum, maximum, average, and histogram below.
+     */
+    std::uint64_t n_non_finite_values = 0;
+
+    /**
+     * The minimal value of the quantity at the output points.
+     */
+    double min_value = 0.;
+
+    /**
+     * The maximal value of the quantity at the output points.
+     */
+    double max_value = 0.;
+
+    /**
+     * The average of the quantity over all output points with a finite
+     * value.
+     */
+    double mean_value = 0.;
+
+    /**
+     * The number of output points whose value falls into each of a number of
+     * equally sized intervals between #min_value and #max_value. Values
+     * equal to #max_value are counted in the last interval.
+     */
+    std::vector<std::uint64_t> histogram;
+  };
+
   /**
    * Flags controlling the behavior of the DataOutFilter class.
    *
@@ -2396,6 +2530,29 @@ namespace DataOutBase
                       const std::string &solution_filename,
                       const MPI_Comm     comm);
 
+  /**
+   * Compute statistics of each of the output quantities in @p patches over
+   * all processes in @p comm, namely the minimum, maximum, and average over
+   * all output points, and a histogram with @p n_histogram_intervals
+   * intervals. This allows to monitor the solution of a large computation
+   * in situ, without writing the fields to files. The statistics are taken
+   * over the output points of the patches, i.e., points that are shared by
+   * several patches are counted several times, and the average is not
+   * weighted by the size of the cells. Values that are not finite, e.g.,
+   * because a solver diverged, are only counted in
+   * FieldStatistics::n_non_finite_values.
+   *
+   * This function needs to be called on all processes of @p comm. The
+   * returned vector, which holds one entry per element of @p data_names, is
+   * the same on all processes.
+   */
+  template <int dim, int spacedim>
+  std::vector<FieldStatistics>
+  compute_field_statistics(const std::vector<Patch<dim, spacedim>> &patches,
+                           const std::vector<std::string>          &data_names,
+                           const unsigned int n_histogram_intervals,
+                           const MPI_Comm     comm);
+
   /**
    * DataOutFilter is an intermediate data format that reduces the amount of
    * data that will be written to files. The object filled by this function
@@ -2961,6 +3118,25 @@ public:
   void
   write_filtered_data(DataOutBase::DataOutFilter &filtered_data) const;
 
+  /**
+   * Obtain data through get_patches() and compute statistics of each of the
+   * output quantities over all processes in @p comm, without writing any
+   * file. See DataOutBase::compute_field_statistics() for details. Together
+   * with a DataPostprocessor, which computes derived quantities on the
+   * output points, this allows to reduce the data of a time step to a few
+   * numbers:
+   * @code
+   * data_out.build_patches();
+   * for (const auto &statistics :
+   *      data_out.compute_field_statistics(20, MPI_COMM_WORLD))
+   *   pcout << statistics.name << ": " << statistics.min_value << " ... "
+   *         << statistics.max_value << std::endl;
+   * @endcode
+   */
+  std::vector<DataOutBase::FieldStatistics>
+  compute_field_statistics(const unsigned int n_histogram_intervals,
+                           const MPI_Comm     comm) const;
+
 
   /**
    * Write data and grid to <tt>out</tt> according to the given data format.
@@ -3397,7 +3573,10 @@ public:
             const ReferenceCell &cell_type);
 
   /**
-   * Constructor that sets all members to provided parameters.
+   * Constructor that sets all members to provided parameters. If
+   * @p solution_group is not empty, the solution datasets are referenced
+   * within this group of the solution file, see
+   * DataOutBase::Hdf5Flags::solution_group.
    */
   XDMFEntry(const std::string   &mesh_filename,
             const std::string   &solution_filename,
@@ -3406,7 +3585,8 @@ public:
             const std::uint64_t  cells,
             const unsigned int   dim,
             const unsigned int   spacedim,
-            const ReferenceCell &cell_type);
+            const ReferenceCell &cell_type,
+            const std::string   &solution_group = "");
 
   /**
    * Record an attribute and associated dimensionality.
@@ -3421,10 +3601,17 @@ public:
    */
   template <class Archive>
   void
-  serialize(Archive &ar, const unsigned int /*version*/)
+  serialize(Archive &ar, const unsigned int version)
   {
     ar &valid &h5_sol_filename &h5_mesh_filename &entry_time &num_nodes
       &num_cells &dimension &space_dimension &cell_type &attribute_dims;
+
+    // the solution group was added in version 1 of this class; archives
+    // written before reference the datasets at the root of the file
+    if (version > 0)
+      ar &h5_sol_group;
+    else
+      h5_sol_group.clear();
   }
 
   /**
@@ -3445,6 +3632,12 @@ private:
    */
   std::string h5_sol_filename;
 
+  /**
+   * The HDF5 group of the solution file in which the solution datasets are
+   * stored, or an empty string if they are stored at the root of the file.
+   */
+  std::string h5_sol_group;
+
   /**
    * The name of the HDF5 mesh file this entry references.
    */
@@ -3529,4 +3722,8 @@ namespace DataOutBase
 
 DEAL_II_NAMESPACE_CLOSE
 
+// Version 1 of XDMFEntry stores the HDF5 group of the solution datasets, see
+// XDMFEntry::serialize()
+BOOST_CLASS_VERSION(dealii::XDMFEntry, 1)
+
 #endif
@@ -273,6 +273,28 @@ public:
   vector_values(const std::vector<Point<dim>>             &points,
                 std::vector<std::vector<RangeNumberType>> &values) const;
 
+  /**
+   * Return the values of the specified component of the function at a batch
+   * of points, given by the lanes of the VectorizedArray coordinates of
+   * @p p. This is the format in which, e.g., FEEvaluation::quadrature_point()
+   * returns the quadrature points of a batch of cells, so right hand sides
+   * and coefficients in matrix-free loops can be evaluated without
+   * unpacking the points:
+   * @code
+   * for (const unsigned int q : phi.quadrature_point_indices())
+   *   phi.submit_value(rhs_function.vectorized_value(phi.quadrature_point(q)),
+   *                    q);
+   * @endcode
+   *
+   * The default implementation calls value() for the point of each lane.
+   * Derived classes can override this function to compute the values of
+   * all lanes with SIMD instructions, which requires including
+   * <tt>deal.II/base/vectorization.h</tt>.
+   */
+  virtual VectorizedArray<RangeNumberType>
+  vectorized_value(const Point<dim, VectorizedArray<RangeNumberType>> &p,
+                   const unsigned int component = 0) const;
+
   /**
    * Return the gradient of the specified component of the function at the
    * given point.
@@ -441,6 +463,10 @@ namespace Functions
     virtual RangeNumberType
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    virtual VectorizedArray<RangeNumberType>
+    vectorized_value(const Point<dim, VectorizedArray<RangeNumberType>> &p,
+                     const unsigned int component = 0) const override;
+
     virtual void
     vector_value(const Point<dim>        &p,
                  Vector<RangeNumberType> &return_value) const override;
@@ -541,6 +567,13 @@ namespace Functions
     virtual RangeNumberType
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    /**
+     * @copydoc Function::vectorized_value()
+     */
+    virtual VectorizedArray<RangeNumberType>
+    vectorized_value(const Point<dim, VectorizedArray<RangeNumberType>> &p,
+                     const unsigned int component = 0) const override;
+
     /**
      * @copydoc Function::gradient()
      */
@@ -21,6 +21,7 @@
 #include <deal.II/base/function.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/tensor_function.h>
+#include <deal.II/base/vectorization.h>
 
 #include <deal.II/lac/vector.h>
 
@@ -126,6 +127,24 @@ Function<dim, RangeNumberType>::vector_values(
 }
 
 
+template <int dim, typename RangeNumberType>
+VectorizedArray<RangeNumberType>
+Function<dim, RangeNumberType>::vectorized_value(
+  const Point<dim, VectorizedArray<RangeNumberType>> &p,
+  const unsigned int                                  component) const
+{
+  VectorizedArray<RangeNumberType> result;
+  for (unsigned int v = 0; v < VectorizedArray<RangeNumberType>::size(); ++v)
+    {
+      Point<dim> point;
+      for (unsigned int d = 0; d < dim; ++d)
+        point[d] = std::real(p[d][v]);
+      result[v] = this->value(point, component);
+    }
+  return result;
+}
+
+
 template <int dim, typename RangeNumberType>
 Tensor<1, dim, RangeNumberType>
 Function<dim, RangeNumberType>::gradient(const Point<dim> &,
@@ -379,6 +398,18 @@ namespace Functions
 
 
 
+  template <int dim, typename RangeNumberType>
+  VectorizedArray<RangeNumberType>
+  ConstantFunction<dim, RangeNumberType>::vectorized_value(
+    const Point<dim, VectorizedArray<RangeNumberType>> &,
+    const unsigned int component) const
+  {
+    AssertIndexRange(component, this->n_components);
+    return VectorizedArray<RangeNumberType>(function_value_vector[component]);
+  }
+
+
+
   template <int dim, typename RangeNumberType>
   void
   ConstantFunction<dim, RangeNumberType>::vector_value(
@@ -554,6 +585,18 @@ namespace Functions
 
 
 
+  template <int dim, typename RangeNumberType>
+  VectorizedArray<RangeNumberType>
+  IdentityFunction<dim, RangeNumberType>::vectorized_value(
+    const Point<dim, VectorizedArray<RangeNumberType>> &p,
+    const unsigned int                                  component) const
+  {
+    AssertIndexRange(component, this->n_components);
+    return p[component];
+  }
+
+
+
   template <int dim, typename RangeNumberType>
   Tensor<1, dim, RangeNumberType>
   IdentityFunction<dim, RangeNumberType>::gradient(
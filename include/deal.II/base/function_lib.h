@@ -52,6 +52,9 @@ namespace Functions
   public:
     virtual double
     value(const Point<dim> &p, const unsigned int component = 0) const override;
+    virtual VectorizedArray<double>
+    vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                     const unsigned int component = 0) const override;
     virtual void
     vector_value(const Point<dim> &p, Vector<double> &values) const override;
     virtual void
@@ -227,6 +230,10 @@ namespace Functions
     virtual double
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    virtual VectorizedArray<double>
+    vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                     const unsigned int component = 0) const override;
+
     virtual void
     value_list(const std::vector<Point<dim>> &points,
                std::vector<double>           &values,
@@ -338,6 +345,13 @@ namespace Functions
     virtual double
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    /**
+     * The values at a batch of points.
+     */
+    virtual VectorizedArray<double>
+    vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                     const unsigned int component = 0) const override;
+
     /**
      * Values at multiple points.
      */
@@ -726,6 +740,13 @@ namespace Functions
     virtual double
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    /**
+     * Return the values of the function at a batch of points.
+     */
+    virtual VectorizedArray<double>
+    vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                     const unsigned int component = 0) const override;
+
     /**
      * Return the gradient of the specified component of the function at the
      * given point.
@@ -780,6 +801,13 @@ namespace Functions
     virtual double
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    /**
+     * Return the values of the function at a batch of points.
+     */
+    virtual VectorizedArray<double>
+    vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                     const unsigned int component = 0) const override;
+
     /**
      * Return the gradient of the specified component of the function at the
      * given point.
@@ -212,6 +212,23 @@ class Vector;
  *                        constants);
  * @endcode
  *
+ * <h3>Compiled evaluation</h3>
+ *
+ * When the function is initialized, the expressions are not only handed to
+ * muParser but also translated into a compact list of instructions, in which
+ * subexpressions appearing several times (also in different components) are
+ * only computed once and subexpressions of constants are evaluated right
+ * away. These instructions are used by value(), vector_value(), and in
+ * particular by value_list(), vector_value_list(), and vectorized_value(),
+ * which evaluate them for as many points at once as there are lanes in
+ * VectorizedArray<double>. The translation supports all operators and all
+ * functions listed above except for <code>rand()</code> and
+ * <code>rand_seed(seed)</code>; if an expression uses one of them, all
+ * evaluations are done by muParser instead. Both ways agree up to roundoff:
+ * the instructions use the same implementations of the functions as
+ * muParser, but muParser's bytecode optimizer combines some operations with
+ * constants in a different order.
+ *
  * @note The difference between this class and the SymbolicFunction class is
  * that the SymbolicFunction class allows to compute first and second order
  * derivatives (in a symbolic way), while this class computes first order
@@ -351,6 +368,40 @@ public:
   virtual double
   value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+  /**
+   * Return all components of the function at the given point. Subexpressions
+   * shared between the components are only evaluated once if the expressions
+   * could be compiled (see the discussion in the general documentation of
+   * this class).
+   */
+  virtual void
+  vector_value(const Point<dim> &p, Vector<double> &values) const override;
+
+  /**
+   * Return the values of one component of the function at a list of points.
+   * If the expressions could be compiled, the points are evaluated in
+   * batches of the width of VectorizedArray<double>.
+   */
+  virtual void
+  value_list(const std::vector<Point<dim>> &points,
+             std::vector<double>           &values,
+             const unsigned int             component = 0) const override;
+
+  /**
+   * Return all components of the function at a list of points.
+   */
+  virtual void
+  vector_value_list(const std::vector<Point<dim>> &points,
+                    std::vector<Vector<double>>   &values) const override;
+
+  /**
+   * Return the value of one component of the function for a batch of points
+   * stored in the lanes of @p p.
+   */
+  virtual VectorizedArray<double>
+  vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                   const unsigned int component = 0) const override;
+
   /**
    * Return an array of function expressions (one per component), used to
    * initialize this function.
@@ -24,7 +24,9 @@
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/thread_local_storage.h>
+#include <deal.II/base/vectorization.h>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -117,6 +119,161 @@ namespace internal
       virtual ~muParserBase() = default;
     };
 
+    /**
+     * A compiled representation of the expressions of all components of a
+     * FunctionParser or TensorFunctionParser object. The expressions are
+     * translated into a flat list of instructions, each of which writes its
+     * result into a register of its own. Identical subexpressions, also across
+     * different components, are only computed once and subexpressions that
+     * only depend on constants are evaluated at compile time. The instructions
+     * can be executed for a single point (with `double` variables) or for a
+     * batch of points at once (with VectorizedArray variables).
+     *
+     * Only a subset of the syntax understood by muParser is supported: the
+     * arithmetic, comparison and logical operators, the ternary operator, and
+     * all functions of get_function_names() except for `erf`, `rand`, and
+     * `rand_seed`. Expressions outside of this subset are not compiled and
+     * left to muParser.
+     */
+    class CompiledExpressions
+    {
+    public:
+      /**
+       * Translate the given expressions, in which the variables given by
+       * @p variable_names and the constants given by @p constants may appear.
+       * The expressions are expected to have been checked by muParser
+       * already. Return whether all expressions could be translated; if not,
+       * the object is left empty.
+       */
+      bool
+      compile(const std::vector<std::string>      &expressions,
+              const std::vector<std::string>      &variable_names,
+              const std::map<std::string, double> &constants);
+
+      /**
+       * Return whether no compiled expressions are stored in this object.
+       */
+      bool
+      empty() const;
+
+      /**
+       * Return the number of registers needed as scratch space by the
+       * evaluate() and evaluate_all() functions.
+       */
+      unsigned int
+      n_registers() const;
+
+      /**
+       * Evaluate the expression of the given component for the values of the
+       * variables given in @p variables, in the order of the variable names
+       * passed to compile(). The array @p registers must be of length
+       * n_registers().
+       */
+      template <typename Number>
+      Number
+      evaluate(const Number      *variables,
+               const unsigned int component,
+               Number            *registers) const;
+
+      /**
+       * Evaluate the expressions of all components at once. The result of
+       * component `c` is afterwards found in
+       * `registers[output_register(c)]`.
+       */
+      template <typename Number>
+      void
+      evaluate_all(const Number *variables, Number *registers) const;
+
+      /**
+       * Return the register holding the result of the given component after
+       * a call to evaluate_all().
+       */
+      unsigned int
+      output_register(const unsigned int component) const;
+
+    private:
+      /**
+       * The operations of an instruction.
+       */
+      enum class Opcode : unsigned char
+      {
+        constant,
+        variable,
+        add,
+        subtract,
+        multiply,
+        divide,
+        negate,
+        less,
+        greater,
+        less_equal,
+        greater_equal,
+        equal,
+        not_equal,
+        select,
+        minimum,
+        maximum,
+        square_root,
+        absolute_value,
+        unary_function,
+        binary_function
+      };
+
+      /**
+       * A single instruction. The arguments are the indices of the
+       * instructions whose results are used. For the opcode `variable`, the
+       * first argument is the index of the variable instead, and for the
+       * opcodes `unary_function` and `binary_function` the field `function`
+       * indexes into the tables of functions without vectorized
+       * implementation that are applied to each lane separately.
+       */
+      struct Instruction
+      {
+        Opcode       opcode;
+        unsigned int arguments[3];
+        unsigned int function;
+        double       value;
+      };
+
+      /**
+       * The class translating an expression into instructions.
+       */
+      class Compiler;
+
+      /**
+       * Compute the result of the given instruction.
+       */
+      template <typename Number>
+      static Number
+      compute(const Instruction &instruction,
+              const Number      *variables,
+              const Number      *registers);
+
+      /**
+       * The list of all instructions. Each instruction only uses results of
+       * instructions with a smaller index.
+       */
+      std::vector<Instruction> instructions;
+
+      /**
+       * For each component, the index of the instruction computing the
+       * result.
+       */
+      std::vector<unsigned int> outputs;
+
+      /**
+       * For each component, the sorted indices of the instructions needed to
+       * compute its result.
+       */
+      std::vector<std::vector<unsigned int>> component_instructions;
+
+      /**
+       * The sorted indices of the instructions needed to compute the results
+       * of all components.
+       */
+      std::vector<unsigned int> all_instructions;
+    };
+
     /**
      * Class containing the mutable state required by muParser.
      *
@@ -152,6 +309,18 @@ namespace internal
        * The actual muParser parser objects (hidden with PIMPL).
        */
       std::vector<std::unique_ptr<muParserBase>> parsers;
+
+      /**
+       * Scratch space for the evaluation of CompiledExpressions for a single
+       * point.
+       */
+      std::vector<double> registers;
+
+      /**
+       * Scratch space for the evaluation of CompiledExpressions for a batch
+       * of points.
+       */
+      std::vector<VectorizedArray<double>> vectorized_registers;
     };
 
     template <int dim, typename Number>
@@ -196,6 +365,36 @@ namespace internal
                     const double       time,
                     ArrayView<Number> &values) const;
 
+      /**
+       * Compute the values of a single component at a list of points. If the
+       * expressions could be compiled, the points are evaluated in batches
+       * of the width of VectorizedArray<double>.
+       */
+      void
+      do_value_list(const ArrayView<const Point<dim>> &points,
+                    const double                       time,
+                    const unsigned int                 component,
+                    const ArrayView<Number>           &values) const;
+
+      /**
+       * Compute the values of all components at a list of points. The value
+       * of component `c` at point `q` is stored in
+       * `values[q * n_components + c]`.
+       */
+      void
+      do_all_values_list(const ArrayView<const Point<dim>> &points,
+                         const double                       time,
+                         const ArrayView<Number>           &values) const;
+
+      /**
+       * Compute the value of a single component for a batch of points stored
+       * in the lanes of @p p.
+       */
+      VectorizedArray<double>
+      do_vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                          const double                               time,
+                          const unsigned int component) const;
+
       /**
        * An array of function expressions (one per component), required to
        * initialize tfp in each thread.
@@ -216,6 +415,12 @@ namespace internal
        */
       std::map<std::string, double> constants;
 
+      /**
+       * The compiled form of the expressions, or an empty object if some of
+       * the expressions can only be evaluated by muParser.
+       */
+      CompiledExpressions compiled_expressions;
+
       /**
        * An array for the variable names, required to initialize fp in each
        * thread.
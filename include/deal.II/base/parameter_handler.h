@@ -20,6 +20,8 @@
 
 #include <deal.II/base/enable_observer_pointer.h>
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/mutex.h>
 #include <deal.II/base/patterns.h>
 
 #include <boost/archive/basic_archive.hpp>
@@ -31,6 +33,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <variant>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -1045,6 +1048,28 @@ public:
               const bool         skip_undefined                     = false,
               const bool         assert_mandatory_entries_are_found = false);
 
+  /**
+   * Like the previous function, but only the process with rank zero in
+   * @p mpi_communicator reads the file @p filename. Its content is then
+   * broadcast to all other processes, which parse it from memory. This
+   * avoids that thousands of processes access the same file at the same
+   * time at the start of a parallel program, which can put considerable
+   * load on parallel file systems.
+   *
+   * Every process parses the content itself, so all actions added via
+   * add_action() (and, consequently, the variables associated with
+   * parameters via add_parameter()) are executed on all processes.
+   *
+   * This function needs to be called on all processes of
+   * @p mpi_communicator.
+   */
+  void
+  parse_input(const std::string &filename,
+              const MPI_Comm     mpi_communicator,
+              const std::string &last_line                          = "",
+              const bool         skip_undefined                     = false,
+              const bool         assert_mandatory_entries_are_found = false);
+
   /**
    * Parse input from a string to populate known parameter fields. The lines
    * in the string must be separated by <tt>@\n</tt> characters.
@@ -1844,6 +1869,43 @@ private:
    */
   std::vector<std::function<void(const std::string &)>> actions;
 
+  /**
+   * The values of entries that have already been converted by one of the
+   * get_integer(), get_double(), or get_bool() functions, indexed by the
+   * full path of the entry. Repeated queries of the same entry then return
+   * the stored value instead of converting the string again. An entry is
+   * removed from this map whenever the value of the parameter changes.
+   */
+  mutable std::map<std::string, std::variant<long int, double, bool>>
+    converted_values;
+
+  /**
+   * A mutex that guards access to the converted_values variable, so that
+   * the get functions can be called concurrently.
+   */
+  mutable Threads::Mutex converted_values_mutex;
+
+  /**
+   * Return the value of the entry with full path @p full_path converted to
+   * type @p T. If the entry has been converted to this type before, the
+   * value is taken from converted_values. Otherwise, @p convert is called
+   * and its result is stored for later queries.
+   */
+  template <typename T, typename Converter>
+  T
+  get_converted_value(const std::string &full_path,
+                      const Converter   &convert) const;
+
+  /**
+   * Parse input from @p input according to the file name extension of
+   * @p filename, i.e., as a .prm, .xml, or .json file.
+   */
+  void
+  parse_input_by_extension(std::istream      &input,
+                           const std::string &filename,
+                           const std::string &last_line,
+                           const bool         skip_undefined);
+
   /**
    * Scan one line of input. <tt>input_filename</tt> and
    * <tt>current_line_n</tt> are the name of the input file and the number of
@@ -2355,6 +2417,11 @@ ParameterHandler::load(Archive &ar, const unsigned int)
 
   ar &*entries.get();
 
+  {
+    std::lock_guard<std::mutex> lock(converted_values_mutex);
+    converted_values.clear();
+  }
+
   std::vector<std::string> descriptions;
   ar                      &descriptions;
 
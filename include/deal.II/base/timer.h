@@ -20,11 +20,15 @@
 #include <deal.II/base/conditional_ostream.h>
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mutex.h>
+#include <deal.II/base/types.h>
 
 #include <chrono>
 #include <list>
 #include <map>
+#include <ostream>
 #include <string>
+#include <thread>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -543,6 +547,44 @@ private:
  * taken by the 10\% of the slowest and fastest ranks, respectively, to get
  * additional insight into the statistical distribution.
  *
+ *
+ * <h3>Nested sections, threads, and flame graphs</h3>
+ *
+ * The tables above list all sections side by side, independent of whether a
+ * section was entered while another one was active. In addition to this flat
+ * view, the class keeps track of the nesting of sections: Each section
+ * entered while another section is active on the same thread is recorded as
+ * a child of that section, so that the call tree of
+ * @code
+ *   {
+ *     TimerOutput::Scope t1(timer, "Solve");
+ *     {
+ *       TimerOutput::Scope t2(timer, "Preconditioner setup");
+ *       ...
+ *     }
+ *     {
+ *       TimerOutput::Scope t3(timer, "Krylov iterations");
+ *       ...
+ *     }
+ *   }
+ * @endcode
+ * can be reconstructed. The nesting is tracked separately for each thread
+ * that enters sections, i.e., the parent of a section is always the
+ * innermost active section on the same thread. The data is accumulated in
+ * per-thread tables with the lock that this class takes anyway, so no
+ * additional synchronization is introduced.
+ *
+ * The nested data can be printed with print_hierarchical_summary(), which
+ * reports the minimum, average, and maximum wall time of every node in the
+ * tree over the ranks of an MPI communicator. For a graphical analysis,
+ * write_folded_stacks() writes the tree in the "folded stack" format that is
+ * understood by flame graph tools (e.g., <code>flamegraph.pl</code> or
+ * speedscope), and write_chrome_trace() writes a timeline of all section
+ * calls in the trace-event JSON format that can be loaded into
+ * <code>chrome://tracing</code> or Perfetto. Since the timeline needs to
+ * store every single call of a section, it needs to be explicitly enabled
+ * with record_trace_events().
+ *
  * @ingroup utilities
  */
 class TimerOutput
@@ -797,6 +839,57 @@ public:
   print_wall_time_statistics(const MPI_Comm mpi_comm,
                              const double   print_quantile = 0.) const;
 
+  /**
+   * Print a formatted table with the wall time spent in nested sections,
+   * where each section is listed below the section that was active on the
+   * same thread when it was entered, see the section on nested sections in
+   * the documentation of this class. If more than one thread has entered
+   * sections, a separate tree is printed for each thread. The reported
+   * times are the minimum, average, and maximum over all ranks in the given
+   * MPI communicator, and the number of calls is the maximum over all
+   * ranks. This function needs to be called on all ranks of @p mpi_comm.
+   */
+  void
+  print_hierarchical_summary(const MPI_Comm mpi_comm = MPI_COMM_SELF) const;
+
+  /**
+   * Write the nested sections in the folded stack format used by flame
+   * graph tools. Each line consists of the names of the nested sections
+   * separated by semicolons, followed by the wall time in microseconds spent
+   * in the innermost section excluding the time spent in its children. If
+   * sections have been entered by more than one thread, the name of each
+   * stack is prefixed by the index of the thread.
+   *
+   * The times are summed over all ranks of the given MPI communicator and
+   * only written on rank 0. This function needs to be called on all ranks
+   * of @p mpi_comm.
+   */
+  void
+  write_folded_stacks(std::ostream  &out,
+                      const MPI_Comm mpi_comm = MPI_COMM_SELF) const;
+
+  /**
+   * Enable or disable the recording of every call to a section with its
+   * start time and duration, which is necessary for write_chrome_trace().
+   * The recording is disabled by default because the memory consumption
+   * grows with the number of calls.
+   */
+  void
+  record_trace_events(const bool record = true);
+
+  /**
+   * Write all section calls recorded since record_trace_events() was called
+   * as "complete" events in the trace-event JSON format, which can be
+   * visualized with <code>chrome://tracing</code> or Perfetto. Each MPI rank
+   * appears as a separate process and each thread as a separate thread in
+   * the timeline. The events of all ranks in the given MPI communicator are
+   * collected and written on rank 0. This function needs to be called on all
+   * ranks of @p mpi_comm.
+   */
+  void
+  write_chrome_trace(std::ostream  &out,
+                     const MPI_Comm mpi_comm = MPI_COMM_SELF) const;
+
   /**
    * By calling this function, all output can be disabled. This function
    * together with enable_output() can be useful if one wants to control the
@@ -856,6 +949,88 @@ private:
    */
   std::map<std::string, Section> sections;
 
+  /**
+   * A structure holding the information about a section that is currently
+   * active on a given thread.
+   */
+  struct ActiveScope
+  {
+    std::string                           name;
+    unsigned int                          nested_section;
+    std::chrono::steady_clock::time_point start_time;
+  };
+
+  /**
+   * A structure holding the accumulated information of a nested section,
+   * i.e., of a section entered while a given parent section was active on
+   * the same thread. The parent and the children are given as indices into
+   * ThreadData::nested_sections.
+   */
+  struct NestedSection
+  {
+    std::string                         name;
+    unsigned int                        parent = numbers::invalid_unsigned_int;
+    std::map<std::string, unsigned int> children;
+    double                              total_wall_time = 0.;
+    unsigned int                        n_calls         = 0;
+  };
+
+  /**
+   * A structure holding the nesting information collected on a single
+   * thread. The nested sections form a tree whose root, stored at index
+   * zero, does not correspond to any section. Each active scope stores the
+   * index of its node in the tree, so that leaving a section does not need
+   * to look up its path.
+   */
+  struct ThreadData
+  {
+    unsigned int               index;
+    std::vector<ActiveScope>   active_scopes;
+    std::vector<NestedSection> nested_sections;
+  };
+
+  /**
+   * A structure describing a single call to a section, used for the
+   * output with write_chrome_trace(). Times are given in microseconds
+   * relative to the construction or the last reset() of this object.
+   */
+  struct TraceEvent
+  {
+    std::string  name;
+    unsigned int thread;
+    double       start;
+    double       duration;
+
+    /**
+     * Write or read the data of this object to or from a stream for the
+     * purpose of serialization using the [BOOST serialization
+     * library](https://www.boost.org/doc/libs/1_74_0/libs/serialization/doc/index.html).
+     */
+    template <class Archive>
+    void
+    serialize(Archive &ar, const unsigned int version);
+  };
+
+  /**
+   * The nesting information of all threads that have entered a section.
+   */
+  std::map<std::thread::id, ThreadData> thread_data;
+
+  /**
+   * Whether to record trace events, see record_trace_events().
+   */
+  bool trace_is_enabled;
+
+  /**
+   * The recorded trace events.
+   */
+  std::vector<TraceEvent> trace_events;
+
+  /**
+   * The reference time for the trace events.
+   */
+  std::chrono::steady_clock::time_point reference_time;
+
   /**
    * The stream object to which we are to output.
    */
@@ -884,7 +1059,7 @@ private:
    * A lock that makes sure that this class gives reasonable results even when
    * used with several threads.
    */
-  Threads::Mutex mutex;
+  mutable Threads::Mutex mutex;
 };
 
 
@@ -883,6 +883,12 @@ namespace Utilities
        * (RSS).
        */
       unsigned long int VmRSS;
+
+      /**
+       * Current resident memory size in kB that is backed by transparent
+       * huge pages, see set_huge_page_threshold().
+       */
+      unsigned long int AnonHugePages;
     };
 
 
@@ -925,11 +931,45 @@ namespace Utilities
      * @param alignment The minimal alignment of the memory block, in bytes.
      * @param size The size of the memory block to be allocated, in bytes.
      *
+     * If the size of the memory block is at least the threshold set by
+     * set_huge_page_threshold(), the memory block is aligned to the size of
+     * a huge page, and the operating system is advised to back it by
+     * transparent huge pages.
+     *
      * @note This function checks internally for error codes, rather than
      * leaving this task to the calling site.
      */
     void
     posix_memalign(void **memptr, std::size_t alignment, std::size_t size);
+
+    /**
+     * Set the minimal size, in bytes, of memory blocks allocated through
+     * posix_memalign() that are to be backed by transparent huge pages of
+     * 2 MB. Since all arrays of AlignedVector, and consequently of Table,
+     * FullMatrix, and the data structures of MatrixFree, are allocated
+     * through posix_memalign(), this reduces the number of TLB misses when
+     * working on large arrays. Small memory blocks are not affected, as
+     * aligning them to huge pages would waste memory.
+     *
+     * A value of zero, which is the default, disables the use of huge
+     * pages. The default can also be set at run time via the environment
+     * variable <tt>DEAL_II_HUGE_PAGE_THRESHOLD</tt>. The setting only
+     * affects memory allocated after the call to this function.
+     *
+     * @note This feature is only available on Linux, and it requires that
+     * transparent huge pages are enabled in the <tt>madvise</tt> or
+     * <tt>always</tt> mode of the kernel. The amount of memory actually
+     * backed by huge pages is reported in MemoryStats::AnonHugePages by
+     * get_memory_stats().
+     */
+    void
+    set_huge_page_threshold(const std::size_t threshold);
+
+    /**
+     * Return the threshold set by set_huge_page_threshold().
+     */
+    std::size_t
+    get_huge_page_threshold();
   } // namespace System
 } // namespace Utilities
 
@@ -0,0 +1,334 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_distributed_cell_cost_model_h
+#define dealii_distributed_cell_cost_model_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/mutex.h>
+
+#include <deal.II/distributed/tria_base.h>
+
+#include <boost/signals2/connection.hpp>
+
+#include <functional>
+#include <vector>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace parallel
+{
+  /**
+   * A class that predicts the computational cost of each cell from measured
+   * run times, and uses these predictions as weights for load balancing.
+   *
+   * While parallel::CellWeights derives the weight of a cell from a fixed
+   * formula provided by the user, this class learns the weights during the
+   * simulation: Cells are sorted into categories by a user-provided function
+   * (for example by their active FE index, their material id, or whether they
+   * are cut by an interface), and the user reports the wall time that was
+   * spent on a number of cells of a certain category, e.g., by timing the
+   * cell loop of a matrix-free operator evaluation or of an assembly
+   * routine. Optionally, the time spent on particles can be reported as
+   * well, together with a function that returns the number of particles in a
+   * cell, for example ParticleHandler::n_particles_in_cell(). Once enough data
+   * has been collected, a call to update() combines the measurements of all
+   * processes into a cost per cell of each category and a cost per particle.
+   * These are averaged with the previous values to smooth out fluctuations
+   * in the measurements.
+   *
+   * The predicted cost of each cell is connected to the
+   * Triangulation::Signals::weight signal of the triangulation, so the next
+   * repartitioning takes the measured costs into account. Since moving cells
+   * between processes is not free, the function needs_repartitioning()
+   * compares the time that would be saved by perfectly balancing the
+   * predicted costs over a given number of time steps with the time of the
+   * migration, so that the triangulation is only repartitioned if it pays
+   * off:
+   * @code
+   * parallel::CellCostModel<dim> cost_model(
+   *   triangulation,
+   *   [](const auto &cell) { return cell->material_id(); });
+   *
+   * for (unsigned int step = 0; step < n_steps; ++step)
+   *   {
+   *     // time the work on the cells of each category and report it
+   *     cost_model.record_category_cost(category, n_cells, wall_time);
+   *     ...
+   *
+   *     if (step % 10 == 0)
+   *       {
+   *         cost_model.update();
+   *         if (cost_model.needs_repartitioning(migration_time, 10))
+   *           triangulation.repartition();
+   *       }
+   *   }
+   * @endcode
+   *
+   * All weights are given relative to the cheapest category that has been
+   * measured, which gets the weight CellCostModel::weight_resolution. Cells
+   * of categories that have not been measured yet are assumed to be as
+   * expensive as the cheapest measured category, rather than free, so that
+   * they are still distributed evenly. Before the first call to update(),
+   * all cells get the weight CellCostModel::weight_resolution, i.e., the
+   * cells are balanced by their number.
+   *
+   * The functions recording costs may be called concurrently from several
+   * threads.
+   *
+   * @ingroup distributed
+   */
+  template <int dim, int spacedim = dim>
+  class CellCostModel
+  {
+  public:
+    /**
+     * The weight of a cell of the cheapest category, which determines the
+     * resolution of the integer weights of the other cells.
+     */
+    static constexpr unsigned int weight_resolution = 1000;
+
+    /**
+     * An alias for the function that determines the category of a cell.
+     * The function is called for active cells and, if cells are going to be
+     * coarsened during repartitioning, for the first child of the future
+     * parent cell.
+     */
+    using CategoryFunction = std::function<unsigned int(
+      const typename Triangulation<dim, spacedim>::cell_iterator &)>;
+
+    /**
+     * An alias for the function that returns the number of particles in an
+     * active cell.
+     */
+    using ParticleCountFunction = std::function<unsigned int(
+      const typename Triangulation<dim, spacedim>::cell_iterator &)>;
+
+    /**
+     * Constructor. Connects the predicted cell costs to the weight signal of
+     * @p triangulation.
+     *
+     * @param[in] triangulation The triangulation whose cells are weighted.
+     * @param[in] category_function The function that assigns a category to
+     *   each cell. If empty, all cells belong to category zero.
+     * @param[in] smoothing The weight of a new measurement when averaging
+     *   it with the previous estimate in update(), between zero (exclusive)
+     *   and one. A value of one discards all previous measurements.
+     */
+    CellCostModel(
+      const parallel::TriangulationBase<dim, spacedim> &triangulation,
+      const CategoryFunction                           &category_function = {},
+      const double                                      smoothing = 0.5);
+
+    /**
+     * Destructor. Disconnects the weighting function from the triangulation.
+     */
+    ~CellCostModel();
+
+    /**
+     * Set the function that returns the number of particles in a cell. The
+     * cost of a cell is then the cost of its category plus the number of
+     * particles times the cost per particle.
+     */
+    void
+    set_particle_count_function(
+      const ParticleCountFunction &particle_count_function);
+
+    /**
+     * Record that @p wall_time seconds have been spent on the given locally
+     * owned @p cell. If a particle count function has been set and the cost
+     * per particle is already known from a previous call to update(), the
+     * predicted time for the particles in the cell is subtracted before the
+     * time is attributed to the cell's category.
+     */
+    void
+    record_cell_cost(
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+      const double                                                wall_time);
+
+    /**
+     * Record that @p wall_time seconds have been spent on @p n_cells cells
+     * of the given @p category, e.g., on the cells of a batch of cells in a
+     * matrix-free loop.
+     */
+    void
+    record_category_cost(const unsigned int category,
+                         const unsigned int n_cells,
+                         const double       wall_time);
+
+    /**
+     * Record that @p wall_time seconds have been spent on @p n_particles
+     * particles.
+     */
+    void
+    record_particle_cost(const unsigned int n_particles,
+                         const double       wall_time);
+
+    /**
+     * Combine the costs recorded since the last call to this function on all
+     * processes into new estimates of the cost per cell of each category and
+     * the cost per particle, and clear the recorded data. Categories without
+     * new measurements keep their previous estimate.
+     *
+     * This function needs to be called on all processes of the
+     * triangulation's MPI communicator.
+     */
+    void
+    update();
+
+    /**
+     * Return the current estimate of the cost per cell of the given
+     * @p category. If no measurement has been made for @p category, the cost
+     * of the cheapest measured category is returned, or zero if no category
+     * has been measured yet.
+     */
+    double
+    get_category_cost(const unsigned int category) const;
+
+    /**
+     * Return the current estimate of the cost per particle.
+     */
+    double
+    get_particle_cost() const;
+
+    /**
+     * Return the predicted cost of the given active @p cell.
+     */
+    double
+    predicted_cost(
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell) const;
+
+    /**
+     * Return the sum of the predicted costs of all locally owned cells.
+     */
+    double
+    predicted_local_cost() const;
+
+    /**
+     * Return the predicted load imbalance of the current partition, i.e.,
+     * the maximum over all processes of the predicted local cost divided by
+     * the average minus one. A value of zero indicates a perfectly balanced
+     * partition.
+     *
+     * This function needs to be called on all processes of the
+     * triangulation's MPI communicator.
+     */
+    double
+    predicted_imbalance() const;
+
+    /**
+     * Return whether repartitioning the triangulation is predicted to pay
+     * off. This is the case if the time that is saved by balancing the
+     * predicted cost perfectly, which is the difference between the maximal
+     * and the average predicted local cost, accumulated over
+     * @p n_cost_evaluations further evaluations of the measured work (e.g.,
+     * time steps until the next check), exceeds the time @p migration_time
+     * needed to repartition the triangulation and to transfer the attached
+     * data. The returned value is the same on all processes.
+     *
+     * This function needs to be called on all processes of the
+     * triangulation's MPI communicator.
+     */
+    bool
+    needs_repartitioning(const double       migration_time,
+                         const unsigned int n_cost_evaluations) const;
+
+  private:
+    /**
+     * The triangulation whose cells are weighted.
+     */
+    const parallel::TriangulationBase<dim, spacedim> &triangulation;
+
+    /**
+     * The function assigning a category to each cell.
+     */
+    const CategoryFunction category_function;
+
+    /**
+     * The function returning the number of particles in each cell.
+     */
+    ParticleCountFunction particle_count_function;
+
+    /**
+     * The weight of a new measurement in update().
+     */
+    const double smoothing;
+
+    /**
+     * The estimated cost per cell of each category. Negative entries denote
+     * categories that have not been measured yet.
+     */
+    std::vector<double> category_costs;
+
+    /**
+     * The smallest positive entry of category_costs, computed in update().
+     * Cells of this cost get the weight weight_resolution, and categories
+     * that have not been measured yet are assumed to have this cost. Zero if
+     * no category has been measured yet.
+     */
+    double reference_cost;
+
+    /**
+     * The estimated cost per particle, negative if not measured yet.
+     */
+    double particle_cost;
+
+    /**
+     * The wall time and the number of cells recorded for each category since
+     * the last call to update().
+     */
+    std::vector<double> recorded_category_times;
+    std::vector<double> recorded_category_cells;
+
+    /**
+     * The wall time and number of particles recorded since the last call to
+     * update().
+     */
+    double recorded_particle_time;
+    double recorded_particles;
+
+    /**
+     * A lock that protects the recorded data when costs are recorded from
+     * several threads.
+     */
+    Threads::Mutex mutex;
+
+    /**
+     * A connection to the weight signal of the triangulation.
+     */
+    boost::signals2::connection connection;
+
+    /**
+     * Return the category of a cell.
+     */
+    unsigned int
+    get_category(
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell) const;
+
+    /**
+     * The function connected to the weight signal of the triangulation.
+     */
+    unsigned int
+    weighting_callback(
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+      const CellStatus                                            status) const;
+  };
+} // namespace parallel
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -1284,6 +1284,51 @@ public:
   void
   load(Archive &ar, const unsigned int version);
 
+  /**
+   * Save the numbering of the degrees of freedom into the file @p filename,
+   * using a binary archive that stores the index arrays of this object as
+   * raw memory. Together with Triangulation::save(), this allows a restart
+   * to skip the enumeration (and possibly renumbering) of the degrees of
+   * freedom:
+   * @code
+   * // at the end of a previous run
+   * triangulation.save("snapshot");
+   * dof_handler.save("snapshot_dofs");
+   *
+   * // at the start of the next run
+   * triangulation.load("snapshot");
+   * DoFHandler<dim> dof_handler(triangulation);
+   * dof_handler.load("snapshot_dofs", fe);
+   * @endcode
+   *
+   * If the triangulation is a parallel one, every process writes its own
+   * file, with the rank of the process appended to @p filename. Loading
+   * the data then requires the same number of processes and the same
+   * partition of the triangulation. The numbering of level degrees of
+   * freedom is not saved. The file also records whether hp-capabilities
+   * were enabled, and load() checks that they are in the same state after
+   * setting the finite elements given to it.
+   *
+   * @note Binary archives are not portable between machines with different
+   * data representations, e.g., byte order.
+   */
+  void
+  save(const std::string &filename) const;
+
+  /**
+   * Load the numbering of the degrees of freedom saved with save() back in,
+   * instead of calling distribute_dofs(). The triangulation needs to be the
+   * same as when the data was saved, and @p fe the same finite element.
+   */
+  void
+  load(const std::string &filename, const FiniteElement<dim, spacedim> &fe);
+
+  /**
+   * Same as above but taking an hp::FECollection object.
+   */
+  void
+  load(const std::string &filename, const hp::FECollection<dim, spacedim> &fe);
+
 #ifdef DOXYGEN
   /**
    * Write and read the data of this object from a stream for the purpose
@@ -1594,6 +1639,13 @@ private:
    */
   std::vector<boost::signals2::connection> tria_listeners_for_transfer;
 
+  /**
+   * Register the given collection of finite elements, as the first step of
+   * distribute_dofs() and load().
+   */
+  void
+  set_fe(const hp::FECollection<dim, spacedim> &fe);
+
   /**
    * Free all memory used for non-multigrid data structures.
    */
@@ -38,6 +38,15 @@ DEAL_II_NAMESPACE_OPEN
 #ifndef DOXYGEN
 template <int, int>
 class MappingQCache;
+
+namespace internal
+{
+  namespace MappingQImplementation
+  {
+    template <int, int>
+    class InverseQuadraticApproximation;
+  }
+} // namespace internal
 #endif
 
 /**
@@ -508,6 +517,25 @@ protected:
    * @}
    */
 
+  /**
+   * Transform the points in @p real_points to the reference cell, given the
+   * mapping support points of a cell in @p support_points (in the format
+   * returned by compute_mapping_support_points()) and an approximation of
+   * the inverse mapping used as initial guess of the Newton iteration. The
+   * Newton iterations are run with VectorizedArray data types over batches
+   * of points. Points for which the transformation fails get
+   * std::numeric_limits<double>::lowest() assigned to the first component,
+   * as described in Mapping::transform_points_real_to_unit_cell(). This
+   * function is only implemented for dim == spacedim.
+   */
+  void
+  transform_points_real_to_unit_cell_internal(
+    const ArrayView<const Point<spacedim>> &support_points,
+    const internal::MappingQImplementation::
+      InverseQuadraticApproximation<dim, spacedim> &inverse_approximation,
+    const ArrayView<const Point<spacedim>>         &real_points,
+    const ArrayView<Point<dim>>                    &unit_points) const;
+
   /**
    * The degree of the polynomials used as shape functions for the mapping of
    * cells.
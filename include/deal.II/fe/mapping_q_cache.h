@@ -50,6 +50,15 @@ class DoFHandler;
  * which is used in all operations of MappingQ. The information of the
  * mapping is pre-computed by the MappingQCache::initialize() function.
  *
+ * For dim == spacedim, the initialize() functions additionally compute an
+ * approximation of the inverse of the mapping on each cell, which is used as
+ * initial guess of the Newton iteration in transform_real_to_unit_cell() and
+ * transform_points_real_to_unit_cell(). Together with the cached support
+ * points, this makes repeated point searches as done by
+ * GridTools::find_active_cell_around_point(), Functions::FEFieldFunction,
+ * FEPointEvaluation or Utilities::MPI::RemotePointEvaluation considerably
+ * cheaper than with a plain MappingQ object.
+ *
  * The use of this class is discussed extensively in step-65.
  */
 template <int dim, int spacedim = dim>
@@ -207,6 +216,30 @@ public:
   get_vertices(const typename Triangulation<dim, spacedim>::cell_iterator &cell)
     const override;
 
+  /**
+   * Transform the point @p p on the real cell to the point on the reference
+   * cell, using the cached mapping support points and the cached
+   * approximation of the inverse mapping as initial guess of the Newton
+   * iteration.
+   */
+  virtual Point<dim>
+  transform_real_to_unit_cell(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const Point<spacedim> &p) const override;
+
+  /**
+   * Transform the points in @p real_points on the real cell to the points on
+   * the reference cell, using the cached mapping support points and the
+   * cached approximation of the inverse mapping as initial guess of the
+   * Newton iteration. The Newton iterations are run on batches of points
+   * with VectorizedArray data types.
+   */
+  virtual void
+  transform_points_real_to_unit_cell(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const ArrayView<const Point<spacedim>>                     &real_points,
+    const ArrayView<Point<dim>> &unit_points) const override;
+
   /**
    * Return the memory consumption (in bytes) of the cache.
    */
@@ -231,6 +264,17 @@ private:
   std::shared_ptr<std::vector<std::vector<std::vector<Point<spacedim>>>>>
     support_point_cache;
 
+  /**
+   * The approximation of the inverse mapping on each cell, used as initial
+   * guess for the transformation from real to unit coordinates. Filled by
+   * initialize() for dim == spacedim in the same layout as
+   * support_point_cache, and shared between clones of this object.
+   */
+  std::shared_ptr<std::vector<std::vector<
+    internal::MappingQImplementation::InverseQuadraticApproximation<dim,
+                                                                    spacedim>>>>
+    inverse_approximation_cache;
+
   /**
    * The connection to Triangulation::signals::any that must be reset once
    * this class goes out of scope.
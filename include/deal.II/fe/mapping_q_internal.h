@@ -829,6 +829,16 @@ namespace internal
       static constexpr unsigned int n_functions =
         (spacedim == 1 ? 3 : (spacedim == 2 ? 6 : 10));
 
+      /**
+       * Default constructor, setting up an approximation that maps all
+       * points to the origin of the reference cell. Needed to store objects
+       * of this class in containers.
+       */
+      InverseQuadraticApproximation()
+        : normalization_length(1.)
+        , is_affine(true)
+      {}
+
       /**
        * Constructor.
        *
@@ -972,6 +982,12 @@ namespace internal
       InverseQuadraticApproximation(const InverseQuadraticApproximation &) =
         default;
 
+      /**
+       * Copy assignment operator.
+       */
+      InverseQuadraticApproximation &
+      operator=(const InverseQuadraticApproximation &) = default;
+
       /**
        * Evaluate the quadratic approximation.
        */
@@ -1024,6 +1040,16 @@ namespace internal
         return result;
       }
 
+      /**
+       * Return the memory consumption of this object in bytes. The object
+       * only holds data of fixed size, so this is just its size.
+       */
+      static constexpr std::size_t
+      memory_consumption()
+      {
+        return sizeof(InverseQuadraticApproximation);
+      }
+
     private:
       /**
        * In order to guarantee a good conditioning, we need to apply a
@@ -1032,12 +1058,12 @@ namespace internal
        * points in real space) and an inverse length scale called
        * `length_normalization` as the distance between the first two points.
        */
-      const Point<spacedim> normalization_shift;
+      Point<spacedim> normalization_shift;
 
       /**
        * See the documentation of `normalization_shift` above.
        */
-      const double normalization_length;
+      double normalization_length;
 
       /**
        * The vector of coefficients in the quadratic approximation.
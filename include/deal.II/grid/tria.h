@@ -3613,13 +3613,24 @@ public:
    * suffixes that indicate the specific use of that file.
    *
    * Save the triangulation into the given file. Internally, this
-   * function calls the save function which uses BOOST archives.
+   * function calls the save function which uses BOOST archives. The
+   * triangulation is written into a binary archive, which stores the
+   * internal arrays of the triangulation (cells, faces, vertices, refinement
+   * tree, and the boundary and manifold ids) as raw memory. Loading the
+   * triangulation with load() therefore does not need to parse any text or
+   * to recreate the mesh by refining the coarse mesh, which makes this a
+   * fast way to restart a computation.
+   *
+   * @note Binary archives are not portable between machines with different
+   * data representations, e.g., byte order.
    */
   virtual void
   save(const std::string &file_basename) const;
 
   /**
-   * Load the triangulation saved with save() back in.
+   * Load the triangulation saved with save() back in. Files written by
+   * earlier versions of the library, which stored the triangulation in a
+   * text archive, can still be read.
    */
   virtual void
   load(const std::string &file_basename);
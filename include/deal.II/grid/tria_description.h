@@ -465,6 +465,82 @@ namespace TriangulationDescription
       const TriangulationDescription::Settings setting =
         TriangulationDescription::Settings::default_setting);
 
+    /**
+     * Construct a TriangulationDescription::Description for a coarse mesh of
+     * which every process only holds a slice, without any process ever
+     * storing the whole mesh. This function is intended for very large
+     * external meshes, for which even the approach of
+     * create_description_from_triangulation_in_groups() with a single process
+     * reading the mesh for a group of processes runs out of memory.
+     *
+     * The input is given in the form of the arguments of
+     * Triangulation::create_triangulation(), split among the processes in
+     * the order of their ranks: The process with rank $r$ holds the vertices
+     * with global indices $[o_r, o_r+n_r)$, where $n_r$ is the number of
+     * entries in @p local_vertices on that process and $o_r$ the sum of the
+     * number of vertices held by the processes with lower ranks. The cells in
+     * @p local_cells may refer to any vertex of the mesh by its global index,
+     * and the cells of all processes together form the coarse mesh. A typical
+     * use case is that every process reads a contiguous block of the list of
+     * vertices and of the list of cells of a mesh file.
+     *
+     * The cells are partitioned among the processes by sorting them along a
+     * Hilbert curve through their centers, in parallel and without
+     * gathering the cells in one place, such that every process owns the
+     * same number of cells (up to rounding) that form a compact part of the
+     * domain. The coarse-cell ids of the cells in the resulting
+     * triangulation are the positions of the cells along this curve, i.e.,
+     * they are not the same as the indices of the cells in the input. Like in
+     * the other functions of this namespace, the locally relevant cells of a
+     * process are its locally owned cells and the cells that share a vertex
+     * with one of them.
+     *
+     * @code
+     * // read the part of the mesh file that belongs to this process
+     * std::vector<Point<dim>>    vertices;
+     * std::vector<CellData<dim>> cells;
+     * ...
+     *
+     * const TriangulationDescription::Description<dim> description =
+     *   TriangulationDescription::Utilities::
+     *     create_description_from_distributed_coarse_mesh(vertices,
+     *                                                     cells,
+     *                                                     comm);
+     *
+     * parallel::fullydistributed::Triangulation<dim> tria(comm);
+     * tria.create_triangulation(description);
+     * @endcode
+     *
+     * @param local_vertices The vertices held by the current process.
+     * @param local_cells The cells held by the current process, with vertex
+     *   indices referring to the global numbering of vertices described
+     *   above. The material and manifold ids of the cells are retained.
+     * @param comm MPI communicator.
+     * @param smoothing Mesh smoothing type.
+     * @param settings See the description of the Settings enumerator.
+     * @return Description to be used to set up a Triangulation.
+     *
+     * @note Boundary and manifold ids of faces and edges are not part of the
+     *   input. All boundary faces get the boundary id zero and can be
+     *   colored after the triangulation has been created. Periodic faces
+     *   are not taken into account when determining the locally relevant
+     *   cells.
+     *
+     * @note If construct_multigrid_hierarchy is set in the settings, the
+     *   @p smoothing parameter is extended with the
+     *   limit_level_difference_at_vertices flag.
+     */
+    template <int dim, int spacedim = dim>
+    Description<dim, spacedim>
+    create_description_from_distributed_coarse_mesh(
+      const std::vector<Point<spacedim>>       &local_vertices,
+      const std::vector<dealii::CellData<dim>> &local_cells,
+      const MPI_Comm                            comm,
+      const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing =
+        dealii::Triangulation<dim, spacedim>::none,
+      const TriangulationDescription::Settings settings =
+        TriangulationDescription::Settings::default_setting);
+
   } // namespace Utilities
 
 
@@ -1199,6 +1199,16 @@ namespace LinearAlgebra
       const std::shared_ptr<const Utilities::MPI::Partitioner> &
       get_partitioner() const;
 
+      /**
+       * Return the object that stores how loops over the locally owned
+       * elements of this vector are split among threads. Vectors set up by
+       * reinit() from another vector share this object with the other
+       * vector, so that both vectors are worked on, and their memory is
+       * first touched, by the same threads.
+       */
+      const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner> &
+      get_thread_loop_partitioner() const;
+
       /**
        * Check whether the given partitioner is compatible with the
        * partitioner used for this vector. Two partitioners are compatible if
@@ -1766,6 +1776,15 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpace>
+    inline const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner> &
+    Vector<Number, MemorySpace>::get_thread_loop_partitioner() const
+    {
+      return thread_loop_partitioner;
+    }
+
+
+
     template <typename Number, typename MemorySpace>
     inline void
     Vector<Number, MemorySpace>::set_ghost_state(const bool ghosted) const
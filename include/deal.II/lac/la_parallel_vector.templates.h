@@ -551,6 +551,7 @@ namespace LinearAlgebra
       clear_mpi_requests();
 
       // check whether we need to reallocate
+      const Number *old_values = data.values.data();
       resize_val(size, comm_sm);
 
       // delete previous content in import data
@@ -560,8 +561,10 @@ namespace LinearAlgebra
       // set partitioner to serial version
       partitioner = std::make_shared<Utilities::MPI::Partitioner>(size);
 
-      // set entries to zero if so requested
-      if (omit_zeroing_entries == false)
+      // set entries to zero if so requested. newly allocated memory is
+      // zeroed in any case, so that it is first touched with the same
+      // thread partitioning as in all later vector operations
+      if (omit_zeroing_entries == false || data.values.data() != old_values)
         this->operator=(Number());
       else
         zero_out_ghost_values();
@@ -614,6 +617,7 @@ namespace LinearAlgebra
       // different (check only if the are allocated
       // differently, not if the actual data is
       // different)
+      const Number *old_values = data.values.data();
       if (partitioner.get() != v.partitioner.get())
         {
           partitioner = v.partitioner;
@@ -622,7 +626,12 @@ namespace LinearAlgebra
           resize_val(new_allocated_size, this->comm_sm);
         }
 
-      if (omit_zeroing_entries == false)
+      // take over the loop partitioner of v before touching the memory, so
+      // that the entries of both vectors are placed by the same threads.
+      // newly allocated memory is zeroed in any case for this reason
+      thread_loop_partitioner = v.thread_loop_partitioner;
+
+      if (omit_zeroing_entries == false || data.values.data() != old_values)
         this->operator=(Number());
       else
         zero_out_ghost_values();
@@ -633,8 +642,6 @@ namespace LinearAlgebra
       // call these methods and hence do not need to have the storage.
       Kokkos::resize(import_data.values_host_buffer, 0);
       Kokkos::resize(import_data.values, 0);
-
-      thread_loop_partitioner = v.thread_loop_partitioner;
     }
 
 
@@ -1063,6 +1063,15 @@ public:
   std::size_t
   memory_consumption() const;
 
+  /**
+   * Return the object that stores how loops over the elements of this vector
+   * are split among threads. Vectors set up by reinit() from another vector
+   * share this object with the other vector, so that both vectors are worked
+   * on, and their memory is first touched, by the same threads.
+   */
+  const std::shared_ptr<parallel::internal::TBBPartitioner> &
+  get_thread_loop_partitioner() const;
+
   /**
    * This function exists for compatibility with the @p
    * parallel vector classes (e.g., LinearAlgebra::distributed::Vector class)
@@ -1105,7 +1114,12 @@ private:
   maybe_reset_thread_partitioner();
 
   /**
-   * Actual implementation of the reinit functions.
+   * Actual implementation of the reinit functions. If new memory needs to be
+   * allocated, it is set to zero even if @p omit_zeroing_entries is
+   * <code>true</code>. This is done in parallel with the
+   * thread_loop_partitioner used by all other vector operations, so that
+   * the memory pages are first touched, and consequently placed into the
+   * NUMA domain of, the threads that later work on them.
    */
   void
   do_reinit(const size_type new_size,
@@ -1412,6 +1426,15 @@ Vector<Number>::compress(VectorOperation::values) const
 
 
 
+template <typename Number>
+inline const std::shared_ptr<parallel::internal::TBBPartitioner> &
+Vector<Number>::get_thread_loop_partitioner() const
+{
+  return thread_loop_partitioner;
+}
+
+
+
 template <typename Number>
 inline bool
 Vector<Number>::has_ghost_elements() const
@@ -1449,13 +1472,14 @@ inline void
 Vector<Number>::reinit(const Vector<Number2> &v,
                        const bool             omit_zeroing_entries)
 {
+  // take over the loop partitioner of v before touching the memory, so that
+  // the entries of both vectors are placed by the same threads
+  thread_loop_partitioner = v.thread_loop_partitioner;
+
   // go to actual reinit functions in case we need to change something with
   // the vector, else there is nothing to be done
   if (!omit_zeroing_entries || size() != v.size())
-    {
-      do_reinit(v.size(), omit_zeroing_entries, false);
-      thread_loop_partitioner = v.thread_loop_partitioner;
-    }
+    do_reinit(v.size(), omit_zeroing_entries, false);
 }
 
 
@@ -1081,12 +1081,14 @@ Vector<Number>::do_reinit(const size_type new_size,
                           const bool      omit_zeroing_entries,
                           const bool      reset_partitioner)
 {
+  const Number *old_values = values.data();
   values.resize_fast(new_size);
-  if (!omit_zeroing_entries)
-    values.fill();
 
   if (reset_partitioner)
     maybe_reset_thread_partitioner();
+
+  if (!omit_zeroing_entries || values.data() != old_values)
+    *this = Number();
 }
 
 
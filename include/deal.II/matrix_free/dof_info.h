@@ -255,6 +255,20 @@ namespace internal
       compute_cell_index_compression(
         const std::vector<unsigned char> &irregular_cells);
 
+      /**
+       * Converts the cell batches of type IndexStorageVariants::interleaved
+       * to a representation by a start index per cell plus offsets relative
+       * to that index. Batches where all cells share the same offsets are
+       * converted to IndexStorageVariants::interleaved_pattern, all other
+       * batches to IndexStorageVariants::interleaved_delta. The compression
+       * is only applied if all interleaved cell batches can be converted,
+       * i.e., if the offsets of the remaining batches fit into 16 bit
+       * integers, and if the new arrays take less memory than the array
+       * dof_indices_interleaved, which is released in that case.
+       */
+      void
+      compute_cell_index_patterns();
+
       /**
        * Finds possible compression for the face indices that we can apply for
        * increased efficiency. Run at the end of reorder_cells.
@@ -389,6 +403,35 @@ namespace internal
          * `row_starts[cell_index*n_vectorization*n_components].first`.
          */
         interleaved,
+        /**
+         * This value indicates that the indices are accessed in the same way
+         * as for the `interleaved` case, but the indices of all cells in the
+         * batch are given by a starting index per cell plus a pattern of
+         * index offsets that is shared among the cells of the batch and
+         * typically many other cell batches. This happens for structured
+         * meshes with a regular numbering of the degrees of freedom. This
+         * storage variant is only set up by compute_cell_index_patterns().
+         * For a cell of this index type, the starting indices are stored in
+         * the array `dof_indices_contiguous` with the index
+         * `cell_index*n_vectorization`, and the offsets in the array
+         * `dof_indices_patterns` starting at the index
+         * `dof_indices_pattern_offsets[cell_index]`.
+         */
+        interleaved_pattern,
+        /**
+         * This value indicates that the indices are accessed in the same way
+         * as for the `interleaved` case, but the indices are given by a
+         * starting index per cell plus the offsets of the indices relative to
+         * that starting index, stored as 16 bit integers. This storage
+         * variant is only set up by compute_cell_index_patterns() for the
+         * cell batches that cannot be represented by
+         * `interleaved_pattern`. For a cell of this index type, the starting
+         * indices are stored in the array `dof_indices_contiguous` with the
+         * index `cell_index*n_vectorization`, and the offsets in interleaved
+         * format in the array `dof_indices_deltas` starting at the index
+         * `dof_indices_pattern_offsets[cell_index]`.
+         */
+        interleaved_delta,
         /**
          * This value indicates that the indices within a cell are all
          * contiguous, and one can get the index to the cell by reading that
@@ -542,6 +585,28 @@ namespace internal
        */
       std::vector<unsigned int> dof_indices_interleaved;
 
+      /**
+       * Offsets of the indices relative to the first index of a cell for
+       * `IndexStorageVariants::interleaved_pattern`, stored for all unique
+       * patterns.
+       */
+      std::vector<unsigned int> dof_indices_patterns;
+
+      /**
+       * Offsets of the indices relative to the first index of a cell for
+       * `IndexStorageVariants::interleaved_delta`, stored in the same
+       * interleaved format as dof_indices_interleaved.
+       */
+      std::vector<short> dof_indices_deltas;
+
+      /**
+       * The index of the first entry in dof_indices_patterns for each cell
+       * batch of type `IndexStorageVariants::interleaved_pattern`, and in
+       * dof_indices_deltas for each cell batch of type
+       * `IndexStorageVariants::interleaved_delta`.
+       */
+      std::vector<unsigned int> dof_indices_pattern_offsets;
+
       /**
        * Compressed index storage for faster access than through @p
        * dof_indices used according to the description in IndexStorageVariants.
@@ -1791,6 +1791,20 @@ private:
   void
   check_template_arguments(const unsigned int fe_no,
                            const unsigned int first_selected_component);
+
+  /**
+   * Storage for the inverse Jacobians on the current cell batch in case
+   * they are computed on the fly, see
+   * MatrixFree::AdditionalData::compute_cell_mapping_on_the_fly.
+   */
+  AlignedVector<Tensor<2, dim, VectorizedArrayType>> jacobians_on_the_fly;
+
+  /**
+   * Storage for the JxW values on the current cell batch in case they are
+   * computed on the fly, see
+   * MatrixFree::AdditionalData::compute_cell_mapping_on_the_fly.
+   */
+  AlignedVector<VectorizedArrayType> JxW_values_on_the_fly;
 };
 
 
@@ -2995,6 +3009,104 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
       return;
     }
 
+  // Case 3b: the indices are given by a start index per lane plus either a
+  // pattern of offsets shared by all lanes or 16 bit offsets per lane ->
+  // decode the indices on the fly and use the same vectorized gather/scatter
+  // path as for the interleaved storage
+  if (this->cell != numbers::invalid_unsigned_int &&
+      (dof_info.index_storage_variants
+           [is_face ? this->dof_access_index :
+                      internal::MatrixFreeFunctions::DoFInfo::dof_access_cell]
+           [this->cell] == internal::MatrixFreeFunctions::DoFInfo::
+                             IndexStorageVariants::interleaved_pattern ||
+       dof_info.index_storage_variants
+           [is_face ? this->dof_access_index :
+                      internal::MatrixFreeFunctions::DoFInfo::dof_access_cell]
+           [this->cell] == internal::MatrixFreeFunctions::DoFInfo::
+                             IndexStorageVariants::interleaved_delta) &&
+      use_vectorized_path)
+    {
+      const unsigned int *start_indices =
+        dof_info
+          .dof_indices_contiguous
+            [internal::MatrixFreeFunctions::DoFInfo::dof_access_cell]
+          .data() +
+        this->cell * n_lanes;
+      const unsigned int component_offset =
+        this->dof_info
+          ->component_dof_indices_offset[this->active_fe_index]
+                                        [this->first_selected_component];
+
+      // exactly one of the two pointers is set, depending on the storage
+      // variant
+      const unsigned int *pattern = nullptr;
+      const short        *deltas  = nullptr;
+      if (dof_info.index_storage_variants
+            [is_face ? this->dof_access_index :
+                       internal::MatrixFreeFunctions::DoFInfo::dof_access_cell]
+            [this->cell] == internal::MatrixFreeFunctions::DoFInfo::
+                              IndexStorageVariants::interleaved_pattern)
+        pattern = dof_info.dof_indices_patterns.data() +
+                  dof_info.dof_indices_pattern_offsets[this->cell] +
+                  component_offset;
+      else
+        deltas = dof_info.dof_indices_deltas.data() +
+                 dof_info.dof_indices_pattern_offsets[this->cell] +
+                 component_offset * n_lanes;
+
+      alignas(64) unsigned int dof_indices[n_lanes];
+
+      const auto compute_next_indices = [&]() {
+        if (pattern != nullptr)
+          {
+            for (unsigned int v = 0; v < n_lanes; ++v)
+              dof_indices[v] = start_indices[v] + *pattern;
+            ++pattern;
+          }
+        else
+          {
+            for (unsigned int v = 0; v < n_lanes; ++v)
+              dof_indices[v] = start_indices[v] + deltas[v];
+            deltas += n_lanes;
+          }
+      };
+
+      std::array<typename VectorType::value_type *, n_components> src_ptrs;
+      if (n_components == 1 || this->n_fe_components == 1)
+        for (unsigned int comp = 0; comp < n_components; ++comp)
+          src_ptrs[comp] =
+            const_cast<typename VectorType::value_type *>(src[comp]->begin());
+      else
+        src_ptrs[0] =
+          const_cast<typename VectorType::value_type *>(src[0]->begin());
+
+      if (n_components == 1 || this->n_fe_components == 1)
+        for (unsigned int i = 0; i < dofs_per_component; ++i)
+          {
+            compute_next_indices();
+            for (unsigned int comp = 0; comp < n_components; ++comp)
+              operation.process_dof_gather(dof_indices,
+                                           *src[comp],
+                                           0,
+                                           src_ptrs[comp],
+                                           values_dofs[comp][i],
+                                           vector_selector);
+          }
+      else
+        for (unsigned int comp = 0; comp < n_components; ++comp)
+          for (unsigned int i = 0; i < dofs_per_component; ++i)
+            {
+              compute_next_indices();
+              operation.process_dof_gather(dof_indices,
+                                           *src[0],
+                                           0,
+                                           src_ptrs[0],
+                                           values_dofs[comp][i],
+                                           vector_selector);
+            }
+      return;
+    }
+
   // Allocate pointers, then initialize all of them to nullptrs and
   // below overwrite the ones we actually use:
   std::array<const unsigned int *, n_lanes> dof_indices;
@@ -6515,10 +6627,30 @@ FEEvaluation<dim,
   this->cell_type =
     this->matrix_free->get_mapping_info().get_cell_type(cell_index);
 
+  const auto &mapping_info = this->matrix_free->get_mapping_info();
   const unsigned int offsets =
     this->mapping_data->data_index_offsets[cell_index];
-  this->jacobian = &this->mapping_data->jacobians[0][offsets];
-  this->J_value  = &this->mapping_data->JxW_values[offsets];
+  if (this->cell_type > internal::MatrixFreeFunctions::GeometryType::affine &&
+      mapping_info.cell_data_on_the_fly)
+    {
+      // interpolate the geometry from the mapping support points, using
+      // temporary memory from the pool of MatrixFree
+      AlignedVector<VectorizedArrayType> *scratch =
+        this->matrix_free->acquire_scratch_data();
+      mapping_info.compute_cell_data_on_the_fly(cell_index,
+                                                this->quad_no,
+                                                *scratch,
+                                                jacobians_on_the_fly,
+                                                JxW_values_on_the_fly);
+      this->matrix_free->release_scratch_data(scratch);
+      this->jacobian = jacobians_on_the_fly.data();
+      this->J_value  = JxW_values_on_the_fly.data();
+    }
+  else
+    {
+      this->jacobian = &this->mapping_data->jacobians[0][offsets];
+      this->J_value  = &this->mapping_data->JxW_values[offsets];
+    }
   if (!this->mapping_data->jacobian_gradients[0].empty())
     {
       this->jacobian_gradients =
@@ -6597,6 +6729,12 @@ FEEvaluation<dim,
                    cell_index / n_lanes));
     }
 
+  Assert(this->cell_type <=
+             internal::MatrixFreeFunctions::GeometryType::affine ||
+           !this->matrix_free->get_mapping_info().cell_data_on_the_fly,
+         ExcMessage("Access to cells by individual indices is not possible "
+                    "when the mapping data is computed on the fly."));
+
   // allocate memory for internal data storage
   if (this->mapped_geometry == nullptr)
     this->mapped_geometry =
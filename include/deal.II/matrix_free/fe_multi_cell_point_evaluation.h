@@ -0,0 +1,526 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_fe_multi_cell_point_evaluation_h
+#define dealii_fe_multi_cell_point_evaluation_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/polynomial.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/dofs/dof_accessor.h>
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe.h>
+#include <deal.II/fe/fe_update_flags.h>
+
+#include <deal.II/lac/read_vector.h>
+
+#include <deal.II/matrix_free/evaluation_flags.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+#include <deal.II/matrix_free/shape_info.h>
+#include <deal.II/matrix_free/tensor_product_point_kernels.h>
+
+#include <array>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * This class evaluates a finite element solution at arbitrary points that
+ * are distributed over many cells, such as the locations of particles or of
+ * Lagrangian markers immersed in a mesh.
+ *
+ * FEPointEvaluation vectorizes over the points within a single cell. If
+ * cells contain only a few points, most lanes of a VectorizedArray remain
+ * unused and the cost of the per-cell reinit() dominates. This class instead
+ * collects the points of a whole set of cells in one call to reinit() and
+ * packs consecutive points into the lanes of VectorizedArray, irrespective
+ * of the cell they belong to. Each lane then reads the coefficients and the
+ * geometry of its own cell, and the tensor-product kernels of
+ * tensor_product_point_kernels.h are run on full SIMD batches:
+ * @code
+ * FEMultiCellPointEvaluation<1, dim> evaluator(fe, update_values);
+ *
+ * // collect the reference coordinates of the particles cell by cell
+ * std::vector<typename DoFHandler<dim>::active_cell_iterator> cells;
+ * std::vector<std::vector<Point<dim>>>                         unit_points;
+ * ...
+ *
+ * evaluator.reinit(cells, unit_points);
+ * evaluator.evaluate(solution, EvaluationFlags::values);
+ *
+ * for (unsigned int c = 0; c < evaluator.n_cells(); ++c)
+ *   for (unsigned int q = 0; q < evaluator.n_points(c); ++q)
+ *     ... = evaluator.get_value(c, q);
+ * @endcode
+ * The points can, e.g., be obtained from Particles::ParticleHandler by
+ * iterating over the particles of each cell and querying
+ * Particles::ParticleAccessor::get_reference_location(), or from the
+ * reference points sent to a process by Utilities::MPI::RemotePointEvaluation.
+ *
+ * The class is restricted to elements that are supported by the fast
+ * tensor-product path of FEPointEvaluation, i.e., elements of type FE_Q,
+ * FE_DGQ and similar, possibly combined in an FESystem with a single base
+ * element whose multiplicity is @p n_components. The geometry of the cells is
+ * described by a d-linear interpolation of the cell vertices, which is the
+ * geometry of MappingQ1. Reference coordinates must have been computed with
+ * the same mapping, since the class does not hold a Mapping object.
+ *
+ * @tparam n_components Number of vector components of the finite element.
+ * @tparam dim Dimension of the mesh.
+ * @tparam Number Scalar number type of the solution vector.
+ */
+template <int n_components, int dim, typename Number = double>
+class FEMultiCellPointEvaluation
+{
+public:
+  /**
+   * The vectorized array type used to process several points at once.
+   */
+  using VectorizedArrayType = VectorizedArray<Number>;
+
+  using ETT = typename internal::FEPointEvaluation::
+    EvaluatorTypeTraits<dim, dim, n_components, Number>;
+
+  /**
+   * The type of the value at a single point, i.e., a scalar for
+   * n_components==1 and a Tensor<1,n_components,Number> otherwise.
+   */
+  using value_type = typename ETT::value_type;
+
+  /**
+   * The type of the gradient at a single point.
+   */
+  using gradient_type = typename ETT::real_gradient_type;
+
+  /**
+   * Constructor.
+   *
+   * @param fe The finite element of the DoFHandler the evaluated vectors
+   * belong to.
+   *
+   * @param update_flags Specifies the quantities that need to be computed in
+   * evaluate(). If update_gradients is set, the inverse Jacobians of the
+   * cells are computed in reinit().
+   */
+  FEMultiCellPointEvaluation(const FiniteElement<dim> &fe,
+                             const UpdateFlags         update_flags);
+
+  /**
+   * Set the points to evaluate. The points are given in reference
+   * coordinates of the respective cell, with @p unit_points[c] holding the
+   * points of @p cells[c]. Cells may have any number of points, including
+   * none.
+   */
+  void
+  reinit(
+    const std::vector<typename DoFHandler<dim>::active_cell_iterator> &cells,
+    const std::vector<std::vector<Point<dim>>> &unit_points);
+
+  /**
+   * Evaluate the finite element function given by @p solution at the points
+   * passed to the last call of reinit().
+   */
+  void
+  evaluate(const ReadVector<Number>               &solution,
+           const EvaluationFlags::EvaluationFlags &evaluation_flags);
+
+  /**
+   * Return the number of cells passed to the last call of reinit().
+   */
+  unsigned int
+  n_cells() const;
+
+  /**
+   * Return the number of points of the cell with index @p cell in the
+   * list passed to reinit().
+   */
+  unsigned int
+  n_points(const unsigned int cell) const;
+
+  /**
+   * Return the value at point @p point_index of the cell with index @p cell,
+   * as computed by the last call to evaluate().
+   */
+  value_type
+  get_value(const unsigned int cell, const unsigned int point_index) const;
+
+  /**
+   * Return the gradient in real coordinates at point @p point_index of the
+   * cell with index @p cell, as computed by the last call to evaluate().
+   */
+  gradient_type
+  get_gradient(const unsigned int cell, const unsigned int point_index) const;
+
+private:
+  /**
+   * Pointer to the finite element.
+   */
+  ObserverPointer<const FiniteElement<dim>> fe;
+
+  /**
+   * The update flags passed to the constructor.
+   */
+  const UpdateFlags update_flags;
+
+  /**
+   * The 1d polynomials of the tensor-product element.
+   */
+  std::vector<Polynomials::Polynomial<double>> poly;
+
+  /**
+   * Whether the element is a Q1 element, in which case the specialized
+   * d-linear kernels are used.
+   */
+  bool use_linear_path;
+
+  /**
+   * Renumbering from the lexicographic numbering of the coefficients, with
+   * the components running slowest, into the numbering of the element. Empty
+   * if the element is already numbered lexicographically.
+   */
+  std::vector<unsigned int> renumber;
+
+  /**
+   * The cells passed to reinit().
+   */
+  std::vector<typename DoFHandler<dim>::active_cell_iterator> cells;
+
+  /**
+   * The start of the points of each cell in the list of all points, with an
+   * additional last entry holding the total number of points.
+   */
+  std::vector<unsigned int> cell_point_offsets;
+
+  /**
+   * For each SIMD batch of points and each lane, the offset of the
+   * coefficients of the lane's cell in #cell_dof_values. Lanes beyond the
+   * last point repeat the offset of the first lane of the batch.
+   */
+  std::vector<unsigned int> lane_dof_offsets;
+
+  /**
+   * The reference coordinates of all points, packed into SIMD batches.
+   */
+  AlignedVector<Point<dim, VectorizedArrayType>> unit_points;
+
+  /**
+   * The transposed inverse Jacobians of the lanes' cells in each SIMD batch,
+   * which transform gradients from reference to real coordinates.
+   */
+  AlignedVector<Tensor<2, dim, VectorizedArrayType>> inverse_jacobians_t;
+
+  /**
+   * The coefficients of all cells, in lexicographic numbering.
+   */
+  std::vector<Number> cell_dof_values;
+
+  /**
+   * The coefficients of one SIMD batch, gathered from #cell_dof_values.
+   */
+  AlignedVector<VectorizedArrayType> batch_dof_values;
+
+  /**
+   * Temporary array holding the dof values of one cell.
+   */
+  std::vector<Number> local_dof_values;
+
+  /**
+   * The values computed by evaluate(), stored component by component for
+   * each SIMD batch.
+   */
+  AlignedVector<VectorizedArrayType> values;
+
+  /**
+   * The gradients computed by evaluate(), stored for each SIMD batch and
+   * component.
+   */
+  AlignedVector<Tensor<1, dim, VectorizedArrayType>> gradients;
+};
+
+
+
+// ----------------------- template and inline functions ----------------------
+
+
+template <int n_components, int dim, typename Number>
+FEMultiCellPointEvaluation<n_components, dim, Number>::
+  FEMultiCellPointEvaluation(const FiniteElement<dim> &fe,
+                             const UpdateFlags         update_flags)
+  : fe(&fe)
+  , update_flags(update_flags)
+{
+  AssertThrow(fe.n_base_elements() == 1 &&
+                fe.element_multiplicity(0) == n_components &&
+                internal::FEPointEvaluation::is_fast_path_supported(fe, 0),
+              ExcMessage("FEMultiCellPointEvaluation only supports elements "
+                         "with a tensor-product polynomial space and a "
+                         "single base element of multiplicity n_components."));
+
+  internal::MatrixFreeFunctions::ShapeInfo<double> shape_info;
+  shape_info.reinit(QMidpoint<1>(), fe, 0);
+  renumber = shape_info.lexicographic_numbering;
+  poly     = internal::FEPointEvaluation::get_polynomial_space(
+    fe.base_element(0));
+
+  bool is_lexicographic = true;
+  for (unsigned int i = 0; i < renumber.size(); ++i)
+    if (i != renumber[i])
+      is_lexicographic = false;
+  if (is_lexicographic)
+    renumber.clear();
+
+  use_linear_path = (poly.size() == 2 && poly[0].value(0.) == 1. &&
+                     poly[0].value(1.) == 0. && poly[1].value(0.) == 0. &&
+                     poly[1].value(1.) == 1.);
+
+  local_dof_values.resize(fe.n_dofs_per_cell());
+  batch_dof_values.resize(fe.n_dofs_per_cell());
+}
+
+
+
+template <int n_components, int dim, typename Number>
+void
+FEMultiCellPointEvaluation<n_components, dim, Number>::reinit(
+  const std::vector<typename DoFHandler<dim>::active_cell_iterator> &cells,
+  const std::vector<std::vector<Point<dim>>> &unit_points)
+{
+  AssertDimension(cells.size(), unit_points.size());
+
+  constexpr unsigned int n_lanes = VectorizedArrayType::size();
+  const unsigned int     dofs_per_cell = fe->n_dofs_per_cell();
+
+  this->cells = cells;
+  cell_point_offsets.resize(cells.size() + 1);
+  cell_point_offsets[0] = 0;
+  for (unsigned int c = 0; c < cells.size(); ++c)
+    cell_point_offsets[c + 1] = cell_point_offsets[c] + unit_points[c].size();
+
+  const unsigned int n_points_total = cell_point_offsets.back();
+  const unsigned int n_batches      = (n_points_total + n_lanes - 1) / n_lanes;
+
+  this->unit_points.resize_fast(n_batches);
+  lane_dof_offsets.resize(n_batches * n_lanes);
+  if (update_flags & update_gradients)
+    inverse_jacobians_t.resize_fast(n_batches);
+
+  // pack the points of all cells into the SIMD lanes; lanes beyond the
+  // last point repeat the first lane of the batch to keep the geometry
+  // regular
+  std::array<Point<dim, VectorizedArrayType>,
+             GeometryInfo<dim>::vertices_per_cell>
+               vertices;
+  unsigned int cell = 0;
+  for (unsigned int b = 0; b < n_batches; ++b)
+    {
+      for (unsigned int lane = 0; lane < n_lanes; ++lane)
+        {
+          const unsigned int q = b * n_lanes + lane;
+          if (q < n_points_total)
+            {
+              while (q >= cell_point_offsets[cell + 1])
+                ++cell;
+              const Point<dim> &p =
+                unit_points[cell][q - cell_point_offsets[cell]];
+              for (unsigned int d = 0; d < dim; ++d)
+                this->unit_points[b][d][lane] = p[d];
+              lane_dof_offsets[q] = cell * dofs_per_cell;
+
+              if (update_flags & update_gradients)
+                for (const unsigned int v :
+                     GeometryInfo<dim>::vertex_indices())
+                  {
+                    const Point<dim> &vertex = cells[cell]->vertex(v);
+                    for (unsigned int d = 0; d < dim; ++d)
+                      vertices[v][d][lane] = vertex[d];
+                  }
+            }
+          else
+            {
+              for (unsigned int d = 0; d < dim; ++d)
+                this->unit_points[b][d][lane] = this->unit_points[b][d][0];
+              lane_dof_offsets[q] = lane_dof_offsets[b * n_lanes];
+
+              if (update_flags & update_gradients)
+                for (const unsigned int v :
+                     GeometryInfo<dim>::vertex_indices())
+                  for (unsigned int d = 0; d < dim; ++d)
+                    vertices[v][d][lane] = vertices[v][d][0];
+            }
+        }
+
+      if (update_flags & update_gradients)
+        {
+          // the derivatives of the d-linear geometry with respect to the
+          // reference coordinates are the columns of the Jacobian
+          const auto derivatives =
+            internal::evaluate_tensor_product_value_and_gradient_linear(
+              vertices.data(), this->unit_points[b]);
+          Tensor<2, dim, VectorizedArrayType> jacobian;
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int e = 0; e < dim; ++e)
+              jacobian[e][d] = derivatives[d][e];
+          inverse_jacobians_t[b] = transpose(invert(jacobian));
+        }
+    }
+}
+
+
+
+template <int n_components, int dim, typename Number>
+void
+FEMultiCellPointEvaluation<n_components, dim, Number>::evaluate(
+  const ReadVector<Number>               &solution,
+  const EvaluationFlags::EvaluationFlags &evaluation_flags)
+{
+  Assert(!(evaluation_flags & EvaluationFlags::values) ||
+           (update_flags & update_values),
+         ExcMessage("Evaluating values requires update_values."));
+  Assert(!(evaluation_flags & EvaluationFlags::gradients) ||
+           (update_flags & update_gradients),
+         ExcMessage("Evaluating gradients requires update_gradients."));
+
+  constexpr unsigned int n_lanes       = VectorizedArrayType::size();
+  const unsigned int     dofs_per_cell = fe->n_dofs_per_cell();
+  const unsigned int     dofs_per_component = dofs_per_cell / n_components;
+  const unsigned int     n_batches          = unit_points.size();
+
+  // read the coefficients of all cells with at least one point into a
+  // contiguous array in lexicographic numbering
+  cell_dof_values.resize(cells.size() * dofs_per_cell);
+  for (unsigned int c = 0; c < cells.size(); ++c)
+    if (cell_point_offsets[c + 1] > cell_point_offsets[c])
+      {
+        cells[c]->get_dof_values(solution,
+                                 local_dof_values.begin(),
+                                 local_dof_values.end());
+        Number *cell_values = cell_dof_values.data() + c * dofs_per_cell;
+        if (renumber.empty())
+          std::copy(local_dof_values.begin(),
+                    local_dof_values.end(),
+                    cell_values);
+        else
+          for (unsigned int i = 0; i < dofs_per_cell; ++i)
+            cell_values[i] = local_dof_values[renumber[i]];
+      }
+
+  if (evaluation_flags & EvaluationFlags::values)
+    values.resize_fast(n_batches * n_components);
+  if (evaluation_flags & EvaluationFlags::gradients)
+    gradients.resize_fast(n_batches * n_components);
+
+  for (unsigned int b = 0; b < n_batches; ++b)
+    {
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        batch_dof_values[i].gather(cell_dof_values.data() + i,
+                                   lane_dof_offsets.data() + b * n_lanes);
+
+      for (unsigned int comp = 0; comp < n_components; ++comp)
+        {
+          const auto result =
+            internal::evaluate_tensor_product_value_and_gradient(
+              poly,
+              ArrayView<const VectorizedArrayType>(batch_dof_values.data() +
+                                                     comp * dofs_per_component,
+                                                   dofs_per_component),
+              unit_points[b],
+              use_linear_path);
+          if (evaluation_flags & EvaluationFlags::values)
+            values[b * n_components + comp] = result.first;
+          if (evaluation_flags & EvaluationFlags::gradients)
+            gradients[b * n_components + comp] =
+              inverse_jacobians_t[b] * result.second;
+        }
+    }
+}
+
+
+
+template <int n_components, int dim, typename Number>
+inline unsigned int
+FEMultiCellPointEvaluation<n_components, dim, Number>::n_cells() const
+{
+  return cells.size();
+}
+
+
+
+template <int n_components, int dim, typename Number>
+inline unsigned int
+FEMultiCellPointEvaluation<n_components, dim, Number>::n_points(
+  const unsigned int cell) const
+{
+  AssertIndexRange(cell, cells.size());
+  return cell_point_offsets[cell + 1] - cell_point_offsets[cell];
+}
+
+
+
+template <int n_components, int dim, typename Number>
+inline typename FEMultiCellPointEvaluation<n_components, dim, Number>::
+  value_type
+  FEMultiCellPointEvaluation<n_components, dim, Number>::get_value(
+    const unsigned int cell,
+    const unsigned int point_index) const
+{
+  AssertIndexRange(point_index, n_points(cell));
+  constexpr unsigned int n_lanes = VectorizedArrayType::size();
+  const unsigned int     q       = cell_point_offsets[cell] + point_index;
+  const unsigned int     offset  = (q / n_lanes) * n_components;
+
+  value_type result;
+  if constexpr (n_components == 1)
+    result = values[offset][q % n_lanes];
+  else
+    for (unsigned int comp = 0; comp < n_components; ++comp)
+      result[comp] = values[offset + comp][q % n_lanes];
+  return result;
+}
+
+
+
+template <int n_components, int dim, typename Number>
+inline typename FEMultiCellPointEvaluation<n_components, dim, Number>::
+  gradient_type
+  FEMultiCellPointEvaluation<n_components, dim, Number>::get_gradient(
+    const unsigned int cell,
+    const unsigned int point_index) const
+{
+  AssertIndexRange(point_index, n_points(cell));
+  constexpr unsigned int n_lanes = VectorizedArrayType::size();
+  const unsigned int     q       = cell_point_offsets[cell] + point_index;
+  const unsigned int     offset  = (q / n_lanes) * n_components;
+
+  gradient_type result;
+  for (unsigned int d = 0; d < dim; ++d)
+    if constexpr (n_components == 1)
+      result[d] = gradients[offset][d][q % n_lanes];
+    else
+      for (unsigned int comp = 0; comp < n_components; ++comp)
+        result[comp][d] = gradients[offset + comp][d][q % n_lanes];
+  return result;
+}
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
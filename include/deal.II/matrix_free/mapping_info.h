@@ -33,6 +33,7 @@
 
 #include <deal.II/matrix_free/face_info.h>
 #include <deal.II/matrix_free/mapping_info_storage.h>
+#include <deal.II/matrix_free/shape_info.h>
 
 #include <memory>
 
@@ -60,6 +61,12 @@ namespace internal
        * for different kinds of iterators, e.g. standard DoFHandler,
        * multigrid, etc.)  on a fixed Triangulation. In addition, a mapping
        * and several 1d quadrature formulas are given.
+       *
+       * If @p cell_data_on_the_fly is set to true, the inverse Jacobians and
+       * JxW values of cells with general geometry are not stored but
+       * recomputed from the mapping support points by
+       * compute_cell_data_on_the_fly(). See the documentation of the member
+       * variable of the same name for the situations where this is possible.
        */
       void
       initialize(
@@ -73,7 +80,8 @@ namespace internal
         const UpdateFlags update_flags_boundary_faces,
         const UpdateFlags update_flags_inner_faces,
         const UpdateFlags update_flags_faces_by_cells,
-        const bool        piola_transform);
+        const bool        piola_transform,
+        const bool        cell_data_on_the_fly = false);
 
       /**
        * Update the information in the given cells and faces that is the
@@ -95,6 +103,25 @@ namespace internal
       GeometryType
       get_cell_type(const unsigned int cell_chunk_no) const;
 
+      /**
+       * For a cell batch of type GeometryType::general and the case the cell
+       * data is not stored but computed on the fly (see the variable
+       * cell_data_on_the_fly), compute the inverse Jacobians (in the
+       * transposed form stored in MappingInfoStorage::jacobians[0]) and the
+       * JxW values in the quadrature points of the quadrature formula with
+       * index @p quad_no. The geometry is interpolated from the mapping
+       * support points stored in cell_mapping_support_points with the
+       * tensor-product evaluators of the matrix-free framework. The array
+       * @p scratch_data is used as temporary storage for the evaluation.
+       */
+      void
+      compute_cell_data_on_the_fly(
+        const unsigned int                                  cell_batch_index,
+        const unsigned int                                  quad_no,
+        AlignedVector<VectorizedArrayType>                 &scratch_data,
+        AlignedVector<Tensor<2, dim, VectorizedArrayType>> &inverse_jacobians,
+        AlignedVector<VectorizedArrayType>                 &JxW_values) const;
+
       /**
        * Clear all data fields in this class.
        */
@@ -171,6 +198,41 @@ namespace internal
        */
       std::vector<MappingInfoStorage<dim, dim, VectorizedArrayType>> cell_data;
 
+      /**
+       * Whether the inverse Jacobians and JxW values on cells of type
+       * GeometryType::general are computed on the fly by
+       * compute_cell_data_on_the_fly() rather than being read from
+       * cell_data. In that case, only the mapping support points of those
+       * cells are kept in cell_mapping_support_points, which reduces the
+       * memory consumption of the mapping data from (dim*dim+1) numbers per
+       * quadrature point to dim numbers per mapping support point. This is
+       * only possible for a single mapping of type MappingQ without
+       * hp-adaptivity, and in case no Jacobian gradients are requested.
+       */
+      bool cell_data_on_the_fly = false;
+
+      /**
+       * The mapping support points of the cell batches of type
+       * GeometryType::general in case cell_data_on_the_fly is set, stored
+       * in the lexicographic numbering of FE_DGQ of the mapping degree and
+       * with the dim components of the points in separate consecutive blocks.
+       */
+      AlignedVector<VectorizedArrayType> cell_mapping_support_points;
+
+      /**
+       * The offset into cell_mapping_support_points for each cell batch.
+       * Cell batches with the same Jacobians as determined in
+       * compute_mapping_q() share the same data.
+       */
+      std::vector<unsigned int> cell_mapping_support_point_offsets;
+
+      /**
+       * The interpolation matrices from the mapping support points to the
+       * quadrature points of each quadrature formula used by
+       * compute_cell_data_on_the_fly().
+       */
+      std::vector<ShapeInfo<Number>> cell_mapping_shape_info;
+
       /**
        * The data cache for the faces.
        */
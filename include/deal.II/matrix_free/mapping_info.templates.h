@@ -52,6 +52,10 @@ namespace internal
       face_data_by_cells.clear();
       cell_type.clear();
       face_type.clear();
+      cell_data_on_the_fly = false;
+      cell_mapping_support_points.clear();
+      cell_mapping_support_point_offsets.clear();
+      cell_mapping_shape_info.clear();
       mapping_collection = nullptr;
       mapping            = nullptr;
     }
@@ -71,7 +75,8 @@ namespace internal
       const UpdateFlags update_flags_boundary_faces,
       const UpdateFlags update_flags_inner_faces,
       const UpdateFlags update_flags_faces_by_cells,
-      const bool        piola_transform)
+      const bool        piola_transform,
+      const bool        cell_data_on_the_fly)
     {
       clear();
       this->mapping_collection = mapping;
@@ -106,6 +111,13 @@ namespace internal
       this->update_flags_inner_faces    = this->update_flags_boundary_faces;
       this->update_flags_faces_by_cells = update_flags_faces_by_cells;
 
+      // Computing the cell data on the fly is only implemented for the
+      // MappingQ path in compute_mapping_q() below, and not for the
+      // derivatives of the Jacobians
+      this->cell_data_on_the_fly =
+        cell_data_on_the_fly &&
+        (this->update_flags_cells & update_jacobian_grads) == 0u;
+
       reference_cell_types.resize(quad.size());
 
       for (unsigned int my_q = 0; my_q < quad.size(); ++my_q)
@@ -190,6 +202,8 @@ namespace internal
         compute_mapping_q(tria, cells, face_info);
       else
         {
+          this->cell_data_on_the_fly = false;
+
           // Could call these functions in parallel, but not useful because
           // the work inside is nicely split up already
           initialize_cells(tria, cells, active_fe_index, *mapping);
@@ -228,6 +242,8 @@ namespace internal
         compute_mapping_q(tria, cells, face_info);
       else
         {
+          this->cell_data_on_the_fly = false;
+
           // Could call these functions in parallel, but not useful because
           // the work inside is nicely split up already
           initialize_cells(tria, cells, active_fe_index, *mapping);
@@ -2785,6 +2801,58 @@ namespace internal
                               preliminary_cell_type.data() + cell + n_lanes);
         }
 
+      // step 3b: in case the cell data is computed on the fly, keep the
+      // mapping support points of the cell batches with general geometry
+      // and skip the tabulation of the Jacobians on those batches in step 4
+      // below; cell batches with the same Jacobians share the same data
+      std::vector<bool> process_cell_data = process_cell;
+      cell_mapping_support_points.clear();
+      cell_mapping_support_point_offsets.clear();
+      cell_mapping_shape_info.clear();
+      if (cell_data_on_the_fly)
+        {
+          cell_mapping_support_point_offsets.resize(
+            cell_type.size(), numbers::invalid_unsigned_int);
+          unsigned int n_general_batches = 0;
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] > affine && process_cell[cell])
+              ++n_general_batches;
+          cell_mapping_support_points.resize_fast(n_general_batches * dim *
+                                                  n_mapping_points);
+
+          unsigned int offset = 0;
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] > affine)
+              {
+                process_cell_data[cell] = false;
+                if (process_cell[cell] == false)
+                  {
+                    cell_mapping_support_point_offsets[cell] =
+                      cell_mapping_support_point_offsets
+                        [cell_data_index_vect[cell]];
+                    continue;
+                  }
+
+                cell_mapping_support_point_offsets[cell] = offset;
+                for (unsigned int v = 0; v < n_lanes; ++v)
+                  {
+                    const double *points =
+                      plain_quadrature_points.data() +
+                      (cell * n_lanes + v) * dim * n_mapping_points;
+                    for (unsigned int i = 0; i < dim * n_mapping_points; ++i)
+                      cell_mapping_support_points[offset + i][v] = points[i];
+                  }
+                offset += dim * n_mapping_points;
+              }
+          AssertDimension(offset, cell_mapping_support_points.size());
+
+          cell_mapping_shape_info.resize(cell_data.size());
+          FE_DGQ<dim> fe_geometry(mapping_degree);
+          for (unsigned int my_q = 0; my_q < cell_data.size(); ++my_q)
+            cell_mapping_shape_info[my_q].reinit(
+              cell_data[my_q].descriptor[0].quadrature, fe_geometry);
+        }
+
       // step 4: compute the data on cells from the cached quadrature
       // points, filling up all SIMD lanes as appropriate
       for (unsigned int my_q = 0; my_q < cell_data.size(); ++my_q)
@@ -2804,10 +2872,13 @@ namespace internal
                   my_data.data_index_offsets[cell_data_index_vect[cell]];
               else
                 my_data.data_index_offsets[cell] = max_size;
-              max_size =
-                std::max(max_size,
-                         my_data.data_index_offsets[cell] +
-                           (cell_type[cell] <= affine ? 2 : n_q_points));
+              if (cell_type[cell] <= affine)
+                max_size =
+                  std::max(max_size, my_data.data_index_offsets[cell] + 2);
+              else if (cell_data_on_the_fly == false)
+                max_size = std::max(max_size,
+                                    my_data.data_index_offsets[cell] +
+                                      n_q_points);
             }
 
           my_data.JxW_values.resize_fast(max_size);
@@ -2848,7 +2919,7 @@ namespace internal
                 tria,
                 cell_array,
                 cell_type,
-                process_cell,
+                process_cell_data,
                 update_flags_cells,
                 plain_quadrature_points,
                 shape_infos[my_q],
@@ -3038,6 +3109,57 @@ namespace internal
 
 
 
+    template <int dim, typename Number, typename VectorizedArrayType>
+    void
+    MappingInfo<dim, Number, VectorizedArrayType>::compute_cell_data_on_the_fly(
+      const unsigned int                                  cell_batch_index,
+      const unsigned int                                  quad_no,
+      AlignedVector<VectorizedArrayType>                 &scratch_data,
+      AlignedVector<Tensor<2, dim, VectorizedArrayType>> &inverse_jacobians,
+      AlignedVector<VectorizedArrayType>                 &JxW_values) const
+    {
+      Assert(cell_data_on_the_fly, ExcInternalError());
+      AssertIndexRange(quad_no, cell_mapping_shape_info.size());
+      AssertIndexRange(cell_batch_index,
+                       cell_mapping_support_point_offsets.size());
+      Assert(cell_mapping_support_point_offsets[cell_batch_index] !=
+               numbers::invalid_unsigned_int,
+             ExcMessage("The mapping support points are only available for "
+                        "cell batches of general type."));
+
+      const ShapeInfo<Number> &shape_info = cell_mapping_shape_info[quad_no];
+      const typename MappingInfoStorage<dim, dim, VectorizedArrayType>::
+        QuadratureDescriptor &descriptor = cell_data[quad_no].descriptor[0];
+      const unsigned int n_q_points = descriptor.n_q_points;
+
+      FEEvaluationData<dim, VectorizedArrayType, false> eval(shape_info);
+      eval.set_data_pointers(&scratch_data, dim);
+      FEEvaluationFactory<dim, VectorizedArrayType>::evaluate(
+        dim,
+        EvaluationFlags::gradients,
+        cell_mapping_support_points.data() +
+          cell_mapping_support_point_offsets[cell_batch_index],
+        eval);
+
+      if (inverse_jacobians.size() != n_q_points)
+        inverse_jacobians.resize_fast(n_q_points);
+      if (JxW_values.size() != n_q_points)
+        JxW_values.resize_fast(n_q_points);
+
+      const VectorizedArrayType *gradients = eval.begin_gradients();
+      for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+          Tensor<2, dim, VectorizedArrayType> jac;
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int e = 0; e < dim; ++e)
+              jac[d][e] = gradients[e + (d * n_q_points + q) * dim];
+          JxW_values[q] = determinant(jac) * descriptor.quadrature_weights[q];
+          inverse_jacobians[q] = transpose(invert(jac));
+        }
+    }
+
+
+
     template <int dim, typename Number, typename VectorizedArrayType>
     void
     MappingInfo<dim, Number, VectorizedArrayType>::initialize_faces_by_cells(
@@ -3375,6 +3497,11 @@ namespace internal
       memory += MemoryConsumption::memory_consumption(face_data_by_cells);
       memory += cell_type.capacity() * sizeof(GeometryType);
       memory += face_type.capacity() * sizeof(GeometryType);
+      memory +=
+        MemoryConsumption::memory_consumption(cell_mapping_support_points);
+      memory += MemoryConsumption::memory_consumption(
+        cell_mapping_support_point_offsets);
+      memory += MemoryConsumption::memory_consumption(cell_mapping_shape_info);
       memory += faces_by_cells_type.capacity() *
                 ReferenceCells::max_n_faces<dim>() * sizeof(GeometryType);
       memory += sizeof(*this);
@@ -3405,6 +3532,17 @@ namespace internal
                                           ReferenceCells::max_n_faces<dim>() *
                                           sizeof(GeometryType));
 
+      if (cell_data_on_the_fly)
+        {
+          out << "    Cell mapping support points:     ";
+          task_info.print_memory_statistics(
+            out,
+            MemoryConsumption::memory_consumption(
+              cell_mapping_support_points) +
+              MemoryConsumption::memory_consumption(
+                cell_mapping_support_point_offsets));
+        }
+
       for (unsigned int j = 0; j < cell_data.size(); ++j)
         {
           out << "    Data component " << j << std::endl;
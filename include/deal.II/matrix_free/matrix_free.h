@@ -251,6 +251,8 @@ public:
           cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(allow_ghosted_vectors_in_loops)
       , store_ghost_cells(false)
+      , compute_cell_mapping_on_the_fly(false)
+      , compress_cell_index_patterns(false)
       , communicator_sm(MPI_COMM_SELF)
     {}
 
@@ -278,6 +280,8 @@ public:
           other.cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(other.allow_ghosted_vectors_in_loops)
       , store_ghost_cells(other.store_ghost_cells)
+      , compute_cell_mapping_on_the_fly(other.compute_cell_mapping_on_the_fly)
+      , compress_cell_index_patterns(other.compress_cell_index_patterns)
       , communicator_sm(other.communicator_sm)
     {}
 
@@ -533,6 +537,51 @@ public:
      */
     bool store_ghost_cells;
 
+    /**
+     * Option to control whether the inverse Jacobians and JxW values on cells
+     * with general (curved) geometry should be computed on the fly in
+     * FEEvaluation::reinit() rather than being precomputed and stored at all
+     * quadrature points. If set to true, only the positions of the mapping
+     * support points of those cells are kept, and the Jacobians are
+     * interpolated from them with the sum-factorization kernels used for
+     * the solution fields. This reduces the memory consumption and the
+     * memory transfer of the mapping data considerably, in particular for
+     * high-order mappings, at the price of additional arithmetic operations
+     * in each FEEvaluation::reinit() call. Cartesian and affine cells as
+     * well as all face data are unaffected by this option.
+     *
+     * This option only takes effect when the mapping is of type MappingQ (or
+     * a derived class), without hp-adaptivity, and when no Jacobian
+     * gradients (i.e., update_hessians or update_jacobian_grads) are
+     * requested; otherwise, the data is stored as usual. Note that for
+     * @p Number set to float, the geometry is evaluated in single precision.
+     * The default value is false.
+     *
+     * @note The mapping data for cells of general type can then only be
+     * accessed via FEEvaluation::reinit(cell_batch_index), not by the
+     * variant with individual cell indices of the various lanes.
+     */
+    bool compute_cell_mapping_on_the_fly;
+
+    /**
+     * Option to control whether the indices of cell batches without
+     * constraints should additionally be compressed into a starting index
+     * per cell plus offsets relative to that index. Cell batches whose cells
+     * share the same offsets, as it happens on structured meshes with a
+     * regular numbering of the degrees of freedom, refer to a table of
+     * unique offset patterns. The offsets of all other cell batches are
+     * stored as 16 bit integers. In
+     * FEEvaluation::read_dof_values() and
+     * FEEvaluation::distribute_local_to_global(), the vectorized gather and
+     * scatter operations then decode the indices on the fly, and the
+     * interleaved copy of the indices is not stored. The compression is only
+     * applied if all cell batches with interleaved indices can be converted
+     * and the result takes less memory than the interleaved indices; see
+     * internal::MatrixFreeFunctions::DoFInfo::compute_cell_index_patterns().
+     * The default value is false.
+     */
+    bool compress_cell_index_patterns;
+
     /**
      * Shared-memory MPI communicator. Default: MPI_COMM_SELF.
      */
@@ -856,7 +856,8 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
         additional_data.mapping_update_flags_boundary_faces,
         additional_data.mapping_update_flags_inner_faces,
         additional_data.mapping_update_flags_faces_by_cells,
-        piola_transform);
+        piola_transform,
+        additional_data.compute_cell_mapping_on_the_fly);
 
       mapping_is_initialized = true;
     }
@@ -2151,7 +2152,11 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
     }
 
   for (auto &di : dof_info)
-    di.compute_vector_zero_access_pattern(task_info, face_info.faces);
+    {
+      if (additional_data.compress_cell_index_patterns)
+        di.compute_cell_index_patterns();
+      di.compute_vector_zero_access_pattern(task_info, face_info.faces);
+    }
 
 #ifdef DEAL_II_WITH_MPI
   {
@@ -302,6 +302,27 @@ protected:
   virtual void
   restrict_and_add_internal(VectorType &dst, const VectorType &src) const = 0;
 
+  /**
+   * Perform prolongation on a vector @p src whose ghost values still need
+   * to be imported. The default implementation first imports the ghost
+   * values and then calls prolongate_and_add_internal(). Derived classes can
+   * override this function to overlap the ghost exchange with the work on
+   * those cells that only access locally owned entries of @p src.
+   */
+  virtual void
+  update_ghost_values_and_prolongate_and_add(VectorType       &dst,
+                                             const VectorType &src) const;
+
+  /**
+   * Perform restriction and subsequently add the contributions to ghost
+   * entries of @p dst to their owners. The default implementation calls
+   * restrict_and_add_internal() followed by compress(). Derived classes can
+   * override this function to overlap the data exchange with the work on
+   * those cells that only write into locally owned entries of @p dst.
+   */
+  virtual void
+  restrict_and_add_and_compress(VectorType &dst, const VectorType &src) const;
+
   /**
    * A wrapper around update_ghost_values() optimized in case the
    * present vector has the same parallel layout of one of the external
@@ -310,6 +331,19 @@ protected:
   void
   update_ghost_values(const VectorType &vec) const;
 
+  /**
+   * Start the ghost value update of update_ghost_values(), to be finished by
+   * update_ghost_values_finish().
+   */
+  void
+  update_ghost_values_start(const VectorType &vec) const;
+
+  /**
+   * Finish the ghost value update started by update_ghost_values_start().
+   */
+  void
+  update_ghost_values_finish(const VectorType &vec) const;
+
   /**
    * A wrapper around compress() optimized in case the
    * present vector has the same parallel layout of one of the external
@@ -318,6 +352,19 @@ protected:
   void
   compress(VectorType &vec, const VectorOperation::values op) const;
 
+  /**
+   * Start the data exchange of compress(), to be finished by
+   * compress_finish().
+   */
+  void
+  compress_start(VectorType &vec, const VectorOperation::values op) const;
+
+  /**
+   * Finish the data exchange started by compress_start().
+   */
+  void
+  compress_finish(VectorType &vec, const VectorOperation::values op) const;
+
   /**
    * A wrapper around zero_out_ghost_values() optimized in case the
    * present vector has the same parallel layout of one of the external
@@ -404,6 +451,18 @@ protected:
    * are a subset of an external Partitioner object.
    */
   mutable AlignedVector<Number> buffer_fine_embedded;
+
+  /**
+   * MPI requests of the split communication with the embedded coarse
+   * partitioner.
+   */
+  mutable std::vector<MPI_Request> requests_coarse_embedded;
+
+  /**
+   * MPI requests of the split communication with the embedded fine
+   * partitioner.
+   */
+  mutable std::vector<MPI_Request> requests_fine_embedded;
 };
 
 
@@ -563,6 +622,37 @@ public:
     const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner_fine)
     override;
 
+  /**
+   * Enable or disable the overlap of communication and computation in
+   * prolongate_and_add() and restrict_and_add(). If enabled, the cell
+   * batches are split into those that only access locally owned entries
+   * of the coarse vector and those that also access ghost entries. During
+   * prolongation, the ghost values of the coarse vector are imported while
+   * the first group is processed; during restriction, the contributions to
+   * the ghost entries are computed first and sent to their owners while the
+   * remaining cells are processed. This hides the latency of the level
+   * transition for strong-scaling runs, at the price of a different order
+   * of the summation (i.e., results agree up to roundoff). The default is
+   * to not overlap communication and computation.
+   *
+   * @note The overlap is only performed for transfer operators set up from
+   * DoFHandler objects, not for the MatrixFree-based reinit() function,
+   * where the cell loop of MatrixFree controls the data exchange.
+   */
+  void
+  set_overlap_communication_computation(const bool flag);
+
+  /**
+   * Return the number of cell batches that only access locally owned
+   * entries of the coarse vector and the number of cell batches that also
+   * access ghost entries, i.e., the sizes of the two groups that are
+   * processed separately if set_overlap_communication_computation() has
+   * been enabled. Both numbers are zero if the overlap is not enabled or
+   * not supported by the current setup.
+   */
+  std::pair<unsigned int, unsigned int>
+  n_overlap_cell_batches() const;
+
   /**
    * Return the memory consumption of the allocated memory in this class.
    */
@@ -578,7 +668,64 @@ protected:
   restrict_and_add_internal(VectorType       &dst,
                             const VectorType &src) const override;
 
+  void
+  update_ghost_values_and_prolongate_and_add(
+    VectorType       &dst,
+    const VectorType &src) const override;
+
+  void
+  restrict_and_add_and_compress(VectorType       &dst,
+                                const VectorType &src) const override;
+
 private:
+  /**
+   * Selection of cell batches processed by prolongate_and_add_batches()
+   * and restrict_and_add_batches().
+   */
+  enum class BatchSelection
+  {
+    /**
+     * All cell batches.
+     */
+    all,
+    /**
+     * Only those cell batches that access locally owned entries of the
+     * coarse vector.
+     */
+    locally_owned_coarse,
+    /**
+     * Only those cell batches that access at least one ghost entry of the
+     * coarse vector.
+     */
+    ghosted_coarse
+  };
+
+  /**
+   * Cell-by-cell prolongation of the cell batches selected by
+   * @p selection, used when no MatrixFree object is available.
+   */
+  void
+  prolongate_and_add_batches(VectorType          &dst,
+                             const VectorType    &src,
+                             const BatchSelection selection) const;
+
+  /**
+   * Cell-by-cell restriction of the cell batches selected by
+   * @p selection, used when no MatrixFree object is available.
+   */
+  void
+  restrict_and_add_batches(VectorType          &dst,
+                           const VectorType    &src,
+                           const BatchSelection selection) const;
+
+  /**
+   * Fill the array batch_accesses_coarse_ghosts from the indices in
+   * constraint_info_coarse. Needs to be called whenever the coarse indices
+   * are changed.
+   */
+  void
+  setup_batch_ghost_access();
+
   /**
    * A multigrid transfer scheme. A multrigrid transfer class can have different
    * transfer schemes to enable p-adaptivity (one transfer scheme per
@@ -717,6 +864,18 @@ private:
    */
   std::vector<unsigned char> weights_are_compressed;
 
+  /**
+   * Store for each cell batch whether it accesses ghost entries of the
+   * coarse vector, in the order the batches are processed. Only filled if
+   * set_overlap_communication_computation() has been enabled.
+   */
+  std::vector<unsigned char> batch_accesses_coarse_ghosts;
+
+  /**
+   * Flag set by set_overlap_communication_computation().
+   */
+  bool overlap_communication_computation = false;
+
   /**
    * Number of components.
    */
@@ -2604,10 +2604,12 @@ namespace internal
   {
     SimpleVectorDataExchange(
       const std::shared_ptr<const Utilities::MPI::Partitioner>
-                            &embedded_partitioner,
-      AlignedVector<Number> &buffer)
+                               &embedded_partitioner,
+      AlignedVector<Number>    &buffer,
+      std::vector<MPI_Request> &requests)
       : embedded_partitioner(embedded_partitioner)
       , buffer(buffer)
+      , requests(requests)
     {}
 
     template <typename VectorType>
@@ -2743,9 +2745,9 @@ namespace internal
 
   private:
     const std::shared_ptr<const Utilities::MPI::Partitioner>
-                                     embedded_partitioner;
-    dealii::AlignedVector<Number>   &buffer;
-    mutable std::vector<MPI_Request> requests;
+                                  embedded_partitioner;
+    dealii::AlignedVector<Number> &buffer;
+    std::vector<MPI_Request>      &requests;
   };
 
 } // namespace internal
@@ -3008,13 +3010,14 @@ MGTwoLevelTransferBase<VectorType>::prolongate_and_add(
   if (use_src_inplace == false)
     this->vec_coarse.copy_locally_owned_data_from(src);
 
-  if ((use_src_inplace == false) || (src_ghosts_have_been_set == false))
-    this->update_ghost_values(*vec_coarse_ptr);
-
   if (use_dst_inplace == false)
     *vec_fine_ptr = Number(0.);
 
-  this->prolongate_and_add_internal(*vec_fine_ptr, *vec_coarse_ptr);
+  if ((use_src_inplace == false) || (src_ghosts_have_been_set == false))
+    this->update_ghost_values_and_prolongate_and_add(*vec_fine_ptr,
+                                                     *vec_coarse_ptr);
+  else
+    this->prolongate_and_add_internal(*vec_fine_ptr, *vec_coarse_ptr);
 
   if (this->vec_fine_needs_ghost_update || use_dst_inplace == false)
     this->compress(*vec_fine_ptr, VectorOperation::add);
@@ -3153,117 +3156,133 @@ MGTwoLevelTransfer<dim, VectorType>::prolongate_and_add_internal(
         0);
     }
   else
-    {
-      const unsigned int n_lanes = VectorizedArrayType::size();
+    prolongate_and_add_batches(dst, src, BatchSelection::all);
+}
 
-      AlignedVector<VectorizedArrayType> evaluation_data_fine;
-      AlignedVector<VectorizedArrayType> evaluation_data_coarse;
 
-      unsigned int cell_counter  = 0;
-      unsigned int batch_counter = 0;
 
-      for (const auto &scheme : schemes)
-        {
-          if (scheme.n_coarse_cells == 0)
-            continue;
+template <int dim, typename VectorType>
+void
+MGTwoLevelTransfer<dim, VectorType>::prolongate_and_add_batches(
+  VectorType          &dst,
+  const VectorType    &src,
+  const BatchSelection selection) const
+{
+  const unsigned int n_lanes = VectorizedArrayType::size();
 
-          const bool needs_interpolation =
-            scheme.prolongation_matrix.empty() == false;
+  AlignedVector<VectorizedArrayType> evaluation_data_fine;
+  AlignedVector<VectorizedArrayType> evaluation_data_coarse;
 
-          evaluation_data_fine.clear();
-          evaluation_data_coarse.clear();
+  unsigned int cell_counter  = 0;
+  unsigned int batch_counter = 0;
 
-          const unsigned int max_n_dofs_per_cell =
-            std::max(scheme.n_dofs_per_cell_fine,
-                     scheme.n_dofs_per_cell_coarse);
-          evaluation_data_fine.resize(max_n_dofs_per_cell);
-          evaluation_data_coarse.resize(max_n_dofs_per_cell);
+  for (const auto &scheme : schemes)
+    {
+      if (scheme.n_coarse_cells == 0)
+        continue;
 
-          internal::CellTransferFactory cell_transfer(scheme.degree_fine,
-                                                      scheme.degree_coarse);
+      const bool needs_interpolation =
+        scheme.prolongation_matrix.empty() == false;
 
-          const unsigned int n_scalar_dofs_fine =
-            scheme.n_dofs_per_cell_fine / n_components;
-          const unsigned int n_scalar_dofs_coarse =
-            scheme.n_dofs_per_cell_coarse / n_components;
+      evaluation_data_fine.clear();
+      evaluation_data_coarse.clear();
 
-          for (unsigned int cell = 0; cell < scheme.n_coarse_cells;
-               cell += n_lanes, ++batch_counter)
-            {
-              const unsigned int n_lanes_filled =
-                (cell + n_lanes > scheme.n_coarse_cells) ?
-                  (scheme.n_coarse_cells - cell) :
-                  n_lanes;
+      const unsigned int max_n_dofs_per_cell =
+        std::max(scheme.n_dofs_per_cell_fine, scheme.n_dofs_per_cell_coarse);
+      evaluation_data_fine.resize(max_n_dofs_per_cell);
+      evaluation_data_coarse.resize(max_n_dofs_per_cell);
 
-              // read from src vector (similar to
-              // FEEvaluation::read_dof_values())
-              internal::VectorReader<Number, VectorizedArrayType> reader;
-              constraint_info_coarse.read_write_operation(
-                reader,
-                src,
-                evaluation_data_coarse.data(),
-                cell_counter,
-                n_lanes_filled,
-                scheme.n_dofs_per_cell_coarse,
-                true);
-              constraint_info_coarse.apply_hanging_node_constraints(
-                cell_counter, n_lanes_filled, false, evaluation_data_coarse);
+      internal::CellTransferFactory cell_transfer(scheme.degree_fine,
+                                                  scheme.degree_coarse);
 
-              // ---------------------------- coarse ---------------------------
-              if (needs_interpolation)
-                for (int c = n_components - 1; c >= 0; --c)
-                  {
-                    internal::CellProlongator<dim, double, VectorizedArrayType>
-                      cell_prolongator(scheme.prolongation_matrix,
-                                       evaluation_data_coarse.begin() +
-                                         c * n_scalar_dofs_coarse,
-                                       evaluation_data_fine.begin() +
-                                         c * n_scalar_dofs_fine);
-
-                    if (scheme.prolongation_matrix.size() <
-                        n_scalar_dofs_fine * n_scalar_dofs_coarse)
-                      cell_transfer.run(cell_prolongator);
-                    else
-                      cell_prolongator.run_full(n_scalar_dofs_fine,
-                                                n_scalar_dofs_coarse);
-                  }
-              else
-                evaluation_data_fine = evaluation_data_coarse; // TODO
-              // ------------------------------ fine ---------------------------
+      const unsigned int n_scalar_dofs_fine =
+        scheme.n_dofs_per_cell_fine / n_components;
+      const unsigned int n_scalar_dofs_coarse =
+        scheme.n_dofs_per_cell_coarse / n_components;
 
-              // weight
-              if (weights.size() > 0)
-                {
-                  const VectorizedArrayType *cell_weights =
-                    weights.data() + weights_start[batch_counter];
-                  if (weights_are_compressed[batch_counter])
-                    internal::
-                      weight_fe_q_dofs_by_entity<dim, -1, VectorizedArrayType>(
-                        cell_weights,
-                        n_components,
-                        scheme.degree_fine + 1,
-                        evaluation_data_fine.begin());
-                  else
-                    for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine;
-                         ++i)
-                      evaluation_data_fine[i] *= cell_weights[i];
-                }
+      for (unsigned int cell = 0; cell < scheme.n_coarse_cells;
+           cell += n_lanes, ++batch_counter)
+        {
+          const unsigned int n_lanes_filled =
+            (cell + n_lanes > scheme.n_coarse_cells) ?
+              (scheme.n_coarse_cells - cell) :
+              n_lanes;
+
+          if ((selection == BatchSelection::locally_owned_coarse &&
+               batch_accesses_coarse_ghosts[batch_counter] != 0) ||
+              (selection == BatchSelection::ghosted_coarse &&
+               batch_accesses_coarse_ghosts[batch_counter] == 0))
+            {
+              cell_counter += n_lanes_filled;
+              continue;
+            }
 
-              // add into dst vector
-              internal::VectorDistributorLocalToGlobal<Number,
-                                                       VectorizedArrayType>
-                writer;
-              constraint_info_fine.read_write_operation(
-                writer,
-                dst,
-                evaluation_data_fine.data(),
-                cell_counter,
-                n_lanes_filled,
-                scheme.n_dofs_per_cell_fine,
-                false);
+          // read from src vector (similar to
+          // FEEvaluation::read_dof_values())
+          internal::VectorReader<Number, VectorizedArrayType> reader;
+          constraint_info_coarse.read_write_operation(
+            reader,
+            src,
+            evaluation_data_coarse.data(),
+            cell_counter,
+            n_lanes_filled,
+            scheme.n_dofs_per_cell_coarse,
+            true);
+          constraint_info_coarse.apply_hanging_node_constraints(
+            cell_counter, n_lanes_filled, false, evaluation_data_coarse);
+
+          // ---------------------------- coarse ---------------------------
+          if (needs_interpolation)
+            for (int c = n_components - 1; c >= 0; --c)
+              {
+                internal::CellProlongator<dim, double, VectorizedArrayType>
+                  cell_prolongator(scheme.prolongation_matrix,
+                                   evaluation_data_coarse.begin() +
+                                     c * n_scalar_dofs_coarse,
+                                   evaluation_data_fine.begin() +
+                                     c * n_scalar_dofs_fine);
+
+                if (scheme.prolongation_matrix.size() <
+                    n_scalar_dofs_fine * n_scalar_dofs_coarse)
+                  cell_transfer.run(cell_prolongator);
+                else
+                  cell_prolongator.run_full(n_scalar_dofs_fine,
+                                            n_scalar_dofs_coarse);
+              }
+          else
+            evaluation_data_fine = evaluation_data_coarse; // TODO
+          // ------------------------------ fine ---------------------------
 
-              cell_counter += n_lanes_filled;
+          // weight
+          if (weights.size() > 0)
+            {
+              const VectorizedArrayType *cell_weights =
+                weights.data() + weights_start[batch_counter];
+              if (weights_are_compressed[batch_counter])
+                internal::
+                  weight_fe_q_dofs_by_entity<dim, -1, VectorizedArrayType>(
+                    cell_weights,
+                    n_components,
+                    scheme.degree_fine + 1,
+                    evaluation_data_fine.begin());
+              else
+                for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine; ++i)
+                  evaluation_data_fine[i] *= cell_weights[i];
             }
+
+          // add into dst vector
+          internal::VectorDistributorLocalToGlobal<Number, VectorizedArrayType>
+            writer;
+          constraint_info_fine.read_write_operation(
+            writer,
+            dst,
+            evaluation_data_fine.data(),
+            cell_counter,
+            n_lanes_filled,
+            scheme.n_dofs_per_cell_fine,
+            false);
+
+          cell_counter += n_lanes_filled;
         }
     }
 }
@@ -3302,7 +3321,7 @@ MGTwoLevelTransferBase<VectorType>::restrict_and_add(
   // since we might add into the ghost values and call compress
   this->zero_out_ghost_values(*vec_coarse_ptr);
 
-  this->restrict_and_add_internal(*vec_coarse_ptr, *vec_fine_ptr);
+  this->restrict_and_add_and_compress(*vec_coarse_ptr, *vec_fine_ptr);
 
   // clean up related to update_ghost_values()
   if (vec_fine_needs_ghost_update == false && use_src_inplace == false)
@@ -3312,14 +3331,36 @@ MGTwoLevelTransferBase<VectorType>::restrict_and_add(
   else if (vec_fine_needs_ghost_update && (src_ghosts_have_been_set == false))
     this->zero_out_ghost_values(*vec_fine_ptr); // external vector
 
-  this->compress(*vec_coarse_ptr, VectorOperation::add);
-
   if (use_dst_inplace == false)
     dst += this->vec_coarse;
 }
 
 
 
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::update_ghost_values_and_prolongate_and_add(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  this->update_ghost_values(src);
+  this->prolongate_and_add_internal(dst, src);
+}
+
+
+
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::restrict_and_add_and_compress(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  this->restrict_and_add_internal(dst, src);
+  this->compress(dst, VectorOperation::add);
+}
+
+
+
 template <int dim, typename VectorType>
 void
 MGTwoLevelTransfer<dim, VectorType>::restrict_and_add_internal(
@@ -3400,123 +3441,264 @@ MGTwoLevelTransfer<dim, VectorType>::restrict_and_add_internal(
         src);
     }
   else
-    {
-      const unsigned int n_lanes = VectorizedArrayType::size();
+    restrict_and_add_batches(dst, src, BatchSelection::all);
+}
 
-      AlignedVector<VectorizedArrayType> evaluation_data_fine;
-      AlignedVector<VectorizedArrayType> evaluation_data_coarse;
 
-      unsigned int cell_counter  = 0;
-      unsigned int batch_counter = 0;
 
-      for (const auto &scheme : schemes)
-        {
-          if (scheme.n_coarse_cells == 0)
-            continue;
+template <int dim, typename VectorType>
+void
+MGTwoLevelTransfer<dim, VectorType>::restrict_and_add_batches(
+  VectorType          &dst,
+  const VectorType    &src,
+  const BatchSelection selection) const
+{
+  const unsigned int n_lanes = VectorizedArrayType::size();
 
-          const bool needs_interpolation =
-            scheme.prolongation_matrix.empty() == false;
+  AlignedVector<VectorizedArrayType> evaluation_data_fine;
+  AlignedVector<VectorizedArrayType> evaluation_data_coarse;
 
-          evaluation_data_fine.clear();
-          evaluation_data_coarse.clear();
+  unsigned int cell_counter  = 0;
+  unsigned int batch_counter = 0;
 
-          const unsigned int max_n_dofs_per_cell =
-            std::max(scheme.n_dofs_per_cell_fine,
-                     scheme.n_dofs_per_cell_coarse);
-          evaluation_data_fine.resize(max_n_dofs_per_cell);
-          evaluation_data_coarse.resize(max_n_dofs_per_cell);
+  for (const auto &scheme : schemes)
+    {
+      if (scheme.n_coarse_cells == 0)
+        continue;
 
-          internal::CellTransferFactory cell_transfer(scheme.degree_fine,
-                                                      scheme.degree_coarse);
+      const bool needs_interpolation =
+        scheme.prolongation_matrix.empty() == false;
 
-          const unsigned int n_scalar_dofs_fine =
-            scheme.n_dofs_per_cell_fine / n_components;
-          const unsigned int n_scalar_dofs_coarse =
-            scheme.n_dofs_per_cell_coarse / n_components;
+      evaluation_data_fine.clear();
+      evaluation_data_coarse.clear();
 
-          for (unsigned int cell = 0; cell < scheme.n_coarse_cells;
-               cell += n_lanes, ++batch_counter)
-            {
-              const unsigned int n_lanes_filled =
-                (cell + n_lanes > scheme.n_coarse_cells) ?
-                  (scheme.n_coarse_cells - cell) :
-                  n_lanes;
+      const unsigned int max_n_dofs_per_cell =
+        std::max(scheme.n_dofs_per_cell_fine, scheme.n_dofs_per_cell_coarse);
+      evaluation_data_fine.resize(max_n_dofs_per_cell);
+      evaluation_data_coarse.resize(max_n_dofs_per_cell);
 
-              // read from source vector
-              internal::VectorReader<Number, VectorizedArrayType> reader;
-              constraint_info_fine.read_write_operation(
-                reader,
-                src,
-                evaluation_data_fine.data(),
-                cell_counter,
-                n_lanes_filled,
-                scheme.n_dofs_per_cell_fine,
-                false);
+      internal::CellTransferFactory cell_transfer(scheme.degree_fine,
+                                                  scheme.degree_coarse);
 
-              // weight
-              if (weights.size() > 0)
-                {
-                  const VectorizedArrayType *cell_weights =
-                    weights.data() + weights_start[batch_counter];
-                  if (weights_are_compressed[batch_counter])
-                    internal::
-                      weight_fe_q_dofs_by_entity<dim, -1, VectorizedArrayType>(
-                        cell_weights,
-                        n_components,
-                        scheme.degree_fine + 1,
-                        evaluation_data_fine.data());
-                  else
-                    for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine;
-                         ++i)
-                      evaluation_data_fine[i] *= cell_weights[i];
-                }
+      const unsigned int n_scalar_dofs_fine =
+        scheme.n_dofs_per_cell_fine / n_components;
+      const unsigned int n_scalar_dofs_coarse =
+        scheme.n_dofs_per_cell_coarse / n_components;
 
-              // ------------------------------ fine ---------------------------
-              if (needs_interpolation)
-                for (int c = n_components - 1; c >= 0; --c)
-                  {
-                    internal::CellRestrictor<dim, double, VectorizedArrayType>
-                      cell_restrictor(scheme.prolongation_matrix,
-                                      evaluation_data_fine.begin() +
-                                        c * n_scalar_dofs_fine,
-                                      evaluation_data_coarse.begin() +
-                                        c * n_scalar_dofs_coarse);
+      for (unsigned int cell = 0; cell < scheme.n_coarse_cells;
+           cell += n_lanes, ++batch_counter)
+        {
+          const unsigned int n_lanes_filled =
+            (cell + n_lanes > scheme.n_coarse_cells) ?
+              (scheme.n_coarse_cells - cell) :
+              n_lanes;
+
+          if ((selection == BatchSelection::locally_owned_coarse &&
+               batch_accesses_coarse_ghosts[batch_counter] != 0) ||
+              (selection == BatchSelection::ghosted_coarse &&
+               batch_accesses_coarse_ghosts[batch_counter] == 0))
+            {
+              cell_counter += n_lanes_filled;
+              continue;
+            }
 
-                    if (scheme.prolongation_matrix.size() <
-                        n_scalar_dofs_fine * n_scalar_dofs_coarse)
-                      cell_transfer.run(cell_restrictor);
-                    else
-                      cell_restrictor.run_full(n_scalar_dofs_fine,
-                                               n_scalar_dofs_coarse);
-                  }
+          // read from source vector
+          internal::VectorReader<Number, VectorizedArrayType> reader;
+          constraint_info_fine.read_write_operation(
+            reader,
+            src,
+            evaluation_data_fine.data(),
+            cell_counter,
+            n_lanes_filled,
+            scheme.n_dofs_per_cell_fine,
+            false);
+
+          // weight
+          if (weights.size() > 0)
+            {
+              const VectorizedArrayType *cell_weights =
+                weights.data() + weights_start[batch_counter];
+              if (weights_are_compressed[batch_counter])
+                internal::
+                  weight_fe_q_dofs_by_entity<dim, -1, VectorizedArrayType>(
+                    cell_weights,
+                    n_components,
+                    scheme.degree_fine + 1,
+                    evaluation_data_fine.data());
               else
-                evaluation_data_coarse = evaluation_data_fine; // TODO
-              // ----------------------------- coarse --------------------------
-
-              // write into dst vector (similar to
-              // FEEvaluation::distribute_global_to_local())
-              internal::VectorDistributorLocalToGlobal<Number,
-                                                       VectorizedArrayType>
-                writer;
-              constraint_info_coarse.apply_hanging_node_constraints(
-                cell_counter, n_lanes_filled, true, evaluation_data_coarse);
-              constraint_info_coarse.read_write_operation(
-                writer,
-                dst,
-                evaluation_data_coarse.data(),
-                cell_counter,
-                n_lanes_filled,
-                scheme.n_dofs_per_cell_coarse,
-                true);
-
-              cell_counter += n_lanes_filled;
+                for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine; ++i)
+                  evaluation_data_fine[i] *= cell_weights[i];
             }
+
+          // ------------------------------ fine ---------------------------
+          if (needs_interpolation)
+            for (int c = n_components - 1; c >= 0; --c)
+              {
+                internal::CellRestrictor<dim, double, VectorizedArrayType>
+                  cell_restrictor(scheme.prolongation_matrix,
+                                  evaluation_data_fine.begin() +
+                                    c * n_scalar_dofs_fine,
+                                  evaluation_data_coarse.begin() +
+                                    c * n_scalar_dofs_coarse);
+
+                if (scheme.prolongation_matrix.size() <
+                    n_scalar_dofs_fine * n_scalar_dofs_coarse)
+                  cell_transfer.run(cell_restrictor);
+                else
+                  cell_restrictor.run_full(n_scalar_dofs_fine,
+                                           n_scalar_dofs_coarse);
+              }
+          else
+            evaluation_data_coarse = evaluation_data_fine; // TODO
+          // ----------------------------- coarse --------------------------
+
+          // write into dst vector (similar to
+          // FEEvaluation::distribute_global_to_local())
+          internal::VectorDistributorLocalToGlobal<Number, VectorizedArrayType>
+            writer;
+          constraint_info_coarse.apply_hanging_node_constraints(
+            cell_counter, n_lanes_filled, true, evaluation_data_coarse);
+          constraint_info_coarse.read_write_operation(
+            writer,
+            dst,
+            evaluation_data_coarse.data(),
+            cell_counter,
+            n_lanes_filled,
+            scheme.n_dofs_per_cell_coarse,
+            true);
+
+          cell_counter += n_lanes_filled;
         }
     }
 }
 
 
 
+template <int dim, typename VectorType>
+void
+MGTwoLevelTransfer<dim, VectorType>::update_ghost_values_and_prolongate_and_add(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  if (batch_accesses_coarse_ghosts.empty())
+    {
+      MGTwoLevelTransferBase<
+        VectorType>::update_ghost_values_and_prolongate_and_add(dst, src);
+      return;
+    }
+
+  // import the ghost values of the coarse vector while working on the cells
+  // that only read locally owned entries
+  this->update_ghost_values_start(src);
+  prolongate_and_add_batches(dst, src, BatchSelection::locally_owned_coarse);
+  this->update_ghost_values_finish(src);
+  prolongate_and_add_batches(dst, src, BatchSelection::ghosted_coarse);
+}
+
+
+
+template <int dim, typename VectorType>
+void
+MGTwoLevelTransfer<dim, VectorType>::restrict_and_add_and_compress(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  if (batch_accesses_coarse_ghosts.empty())
+    {
+      MGTwoLevelTransferBase<VectorType>::restrict_and_add_and_compress(dst,
+                                                                        src);
+      return;
+    }
+
+  // compute the contributions to the ghost entries of the coarse vector
+  // first, send them to their owners and work on the remaining cells while
+  // the data is in flight
+  restrict_and_add_batches(dst, src, BatchSelection::ghosted_coarse);
+  this->compress_start(dst, VectorOperation::add);
+  restrict_and_add_batches(dst, src, BatchSelection::locally_owned_coarse);
+  this->compress_finish(dst, VectorOperation::add);
+}
+
+
+
+template <int dim, typename VectorType>
+void
+MGTwoLevelTransfer<dim, VectorType>::set_overlap_communication_computation(
+  const bool flag)
+{
+  overlap_communication_computation = flag;
+  setup_batch_ghost_access();
+}
+
+
+
+template <int dim, typename VectorType>
+std::pair<unsigned int, unsigned int>
+MGTwoLevelTransfer<dim, VectorType>::n_overlap_cell_batches() const
+{
+  const unsigned int n_ghosted_batches =
+    std::count(batch_accesses_coarse_ghosts.begin(),
+               batch_accesses_coarse_ghosts.end(),
+               1);
+  return {batch_accesses_coarse_ghosts.size() - n_ghosted_batches,
+          n_ghosted_batches};
+}
+
+
+
+template <int dim, typename VectorType>
+void
+MGTwoLevelTransfer<dim, VectorType>::setup_batch_ghost_access()
+{
+  batch_accesses_coarse_ghosts.clear();
+
+  if (overlap_communication_computation == false ||
+      matrix_free_data.get() != nullptr || this->partitioner_coarse == nullptr)
+    return;
+
+  const unsigned int n_lanes = VectorizedArrayType::size();
+  const unsigned int n_locally_owned_coarse =
+    this->partitioner_coarse->locally_owned_size();
+
+  const auto cell_accesses_ghosts = [&](const unsigned int cell) {
+    for (unsigned int i = constraint_info_coarse.row_starts[cell].first;
+         i < constraint_info_coarse.row_starts[cell + 1].first;
+         ++i)
+      if (constraint_info_coarse.dof_indices[i] >= n_locally_owned_coarse)
+        return true;
+
+    if (constraint_info_coarse.row_starts_plain_indices.empty() == false)
+      for (unsigned int i =
+             constraint_info_coarse.row_starts_plain_indices[cell];
+           i < constraint_info_coarse.row_starts_plain_indices[cell + 1];
+           ++i)
+        if (constraint_info_coarse.plain_dof_indices[i] >=
+            n_locally_owned_coarse)
+          return true;
+
+    return false;
+  };
+
+  // the batches are enumerated in the same order as in
+  // prolongate_and_add_batches() and restrict_and_add_batches()
+  unsigned int cell_counter = 0;
+  for (const auto &scheme : schemes)
+    for (unsigned int cell = 0; cell < scheme.n_coarse_cells; cell += n_lanes)
+      {
+        const unsigned int n_lanes_filled =
+          std::min(n_lanes, scheme.n_coarse_cells - cell);
+
+        bool accesses_ghosts = false;
+        for (unsigned int v = 0; v < n_lanes_filled; ++v)
+          accesses_ghosts |= cell_accesses_ghosts(cell_counter + v);
+        batch_accesses_coarse_ghosts.push_back(accesses_ghosts ? 1 : 0);
+
+        cell_counter += n_lanes_filled;
+      }
+}
+
+
+
 template <int dim, typename VectorType>
 void
 MGTwoLevelTransfer<dim, VectorType>::interpolate(VectorType       &dst,
@@ -3843,13 +4025,19 @@ MGTwoLevelTransfer<dim, VectorType>::enable_inplace_operations_if_possible(
 {
   if (matrix_free_data.get() != nullptr)
     return std::make_pair(true, true);
-  else
-    return this->internal_enable_inplace_operations_if_possible(
+
+  const std::pair<bool, bool> success_flags =
+    this->internal_enable_inplace_operations_if_possible(
       external_partitioner_coarse,
       external_partitioner_fine,
       this->vec_fine_needs_ghost_update,
       constraint_info_coarse,
       constraint_info_fine.dof_indices);
+
+  // the indices of the coarse vector might have changed
+  setup_batch_ghost_access();
+
+  return success_flags;
 }
 
 
@@ -3873,6 +4061,8 @@ MGTwoLevelTransfer<dim, VectorType>::reinit_geometric_transfer(
     mg_level_fine,
     mg_level_coarse,
     *this);
+
+  setup_batch_ghost_access();
 }
 
 
@@ -3896,6 +4086,8 @@ MGTwoLevelTransfer<dim, VectorType>::reinit_polynomial_transfer(
     mg_level_fine,
     mg_level_coarse,
     *this);
+
+  setup_batch_ghost_access();
 }
 
 
@@ -3977,6 +4169,8 @@ MGTwoLevelTransfer<dim, VectorType>::reinit(
       mg_level_fine,
       mg_level_coarse,
       *this);
+
+  setup_batch_ghost_access();
 }
 
 
@@ -3990,6 +4184,7 @@ MGTwoLevelTransfer<dim, VectorType>::reinit(
   const unsigned int             dof_no_coarse)
 {
   matrix_free_data = std::make_unique<MatrixFreeRelatedData>();
+  batch_accesses_coarse_ghosts.clear();
 
   MatrixFreeRelatedData &data = *matrix_free_data;
   data.matrix_free_fine       = &matrix_free_fine;
@@ -4173,6 +4368,7 @@ MGTwoLevelTransfer<dim, VectorType>::memory_consumption() const
   size += weights.memory_consumption();
   size += MemoryConsumption::memory_consumption(weights_start);
   size += MemoryConsumption::memory_consumption(weights_are_compressed);
+  size += MemoryConsumption::memory_consumption(batch_accesses_coarse_ghosts);
   size += constraint_info_coarse.memory_consumption();
   size += constraint_info_fine.memory_consumption();
 
@@ -4189,12 +4385,15 @@ MGTwoLevelTransferBase<VectorType>::update_ghost_values(
   if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
       (this->partitioner_coarse_embedded != nullptr))
     internal::SimpleVectorDataExchange<Number>(
-      this->partitioner_coarse_embedded, this->buffer_coarse_embedded)
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
       .update_ghost_values(vec);
   else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
            (this->partitioner_fine_embedded != nullptr))
     internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
-                                               this->buffer_fine_embedded)
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
       .update_ghost_values(vec);
   else
     vec.update_ghost_values();
@@ -4202,6 +4401,54 @@ MGTwoLevelTransferBase<VectorType>::update_ghost_values(
 
 
 
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::update_ghost_values_start(
+  const VectorType &vec) const
+{
+  if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
+      (this->partitioner_coarse_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
+      .update_ghost_values_start(vec);
+  else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
+           (this->partitioner_fine_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
+      .update_ghost_values_start(vec);
+  else
+    vec.update_ghost_values_start();
+}
+
+
+
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::update_ghost_values_finish(
+  const VectorType &vec) const
+{
+  if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
+      (this->partitioner_coarse_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
+      .update_ghost_values_finish(vec);
+  else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
+           (this->partitioner_fine_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
+      .update_ghost_values_finish(vec);
+  else
+    vec.update_ghost_values_finish();
+}
+
+
+
 template <typename VectorType>
 void
 MGTwoLevelTransferBase<VectorType>::compress(
@@ -4213,12 +4460,15 @@ MGTwoLevelTransferBase<VectorType>::compress(
   if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
       (this->partitioner_coarse_embedded != nullptr))
     internal::SimpleVectorDataExchange<Number>(
-      this->partitioner_coarse_embedded, this->buffer_coarse_embedded)
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
       .compress(vec);
   else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
            (this->partitioner_fine_embedded != nullptr))
     internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
-                                               this->buffer_fine_embedded)
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
       .compress(vec);
   else
     vec.compress(op);
@@ -4226,6 +4476,60 @@ MGTwoLevelTransferBase<VectorType>::compress(
 
 
 
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::compress_start(
+  VectorType                   &vec,
+  const VectorOperation::values op) const
+{
+  Assert(op == VectorOperation::add, ExcNotImplemented());
+
+  if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
+      (this->partitioner_coarse_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
+      .compress_start(vec);
+  else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
+           (this->partitioner_fine_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
+      .compress_start(vec);
+  else
+    vec.compress_start(0, op);
+}
+
+
+
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::compress_finish(
+  VectorType                   &vec,
+  const VectorOperation::values op) const
+{
+  Assert(op == VectorOperation::add, ExcNotImplemented());
+
+  if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
+      (this->partitioner_coarse_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
+      .compress_finish(vec);
+  else if ((vec.get_partitioner().get() == this->partitioner_fine.get()) &&
+           (this->partitioner_fine_embedded != nullptr))
+    internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
+      .compress_finish(vec);
+  else
+    vec.compress_finish(op);
+}
+
+
+
 template <typename VectorType>
 void
 MGTwoLevelTransferBase<VectorType>::zero_out_ghost_values(
@@ -4234,12 +4538,15 @@ MGTwoLevelTransferBase<VectorType>::zero_out_ghost_values(
   if ((vec.get_partitioner().get() == this->partitioner_coarse.get()) &&
       (this->partitioner_coarse_embedded != nullptr))
     internal::SimpleVectorDataExchange<Number>(
-      this->partitioner_coarse_embedded, this->buffer_coarse_embedded)
+      this->partitioner_coarse_embedded,
+      this->buffer_coarse_embedded,
+      this->requests_coarse_embedded)
       .zero_out_ghost_values(vec);
   else if ((vec.get_partitioner().get() == (this->partitioner_fine.get()) &&
             this->partitioner_fine_embedded != nullptr))
     internal::SimpleVectorDataExchange<Number>(this->partitioner_fine_embedded,
-                                               this->buffer_fine_embedded)
+                                               this->buffer_fine_embedded,
+                                               this->requests_fine_embedded)
       .zero_out_ghost_values(vec);
   else
     vec.zero_out_ghost_values();
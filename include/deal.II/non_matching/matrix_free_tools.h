@@ -0,0 +1,162 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_non_matching_matrix_free_tools_h
+#define dealii_non_matching_matrix_free_tools_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/quadrature.h>
+
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/non_matching/immersed_surface_quadrature.h>
+#include <deal.II/non_matching/mapping_info.h>
+#include <deal.II/non_matching/mesh_classifier.h>
+#include <deal.II/non_matching/quadrature_generator.h>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace NonMatching
+{
+  /**
+   * A namespace for utility functions that evaluate immersed quadrature
+   * rules within matrix-free loops.
+   */
+  namespace MatrixFreeTools
+  {
+    /**
+     * Compute the mapping information on the intersected cells of
+     * @p matrix_free for the immersed quadrature rules created by
+     * @p quadrature_generator, so that operators can use FEEvaluation on
+     * the cell batches inside or outside of the domain and FEPointEvaluation
+     * on the batches of intersected cells.
+     *
+     * The cell batches of @p matrix_free need to be grouped by their
+     * location relative to the level set function, i.e., @p matrix_free
+     * needs to be set up with
+     * MeshClassifier::get_cell_vectorization_categories() as
+     * MatrixFree::AdditionalData::cell_vectorization_category. All cells of
+     * the batches with category LocationToLevelSet::intersected are then
+     * passed to @p quadrature_generator, and the inside, surface, and outside
+     * quadrature rules are handed to MappingInfo::reinit_cells() and
+     * MappingInfo::reinit_surface() of @p mapping_info_inside,
+     * @p mapping_info_surface, and @p mapping_info_outside, respectively.
+     * Any of the MappingInfo objects may be a `nullptr`, in which case the
+     * corresponding quadrature rules are not used.
+     *
+     * The MappingInfo objects only store the data of the intersected cells,
+     * but are indexed by the active cell index. The evaluation for lane
+     * `v` of an intersected cell batch `cell` is therefore set up with
+     * @code
+     * FEPointEvaluation<1, dim> evaluator(mapping_info_surface, fe);
+     * ...
+     * evaluator.reinit(
+     *   matrix_free.get_cell_iterator(cell, v)->active_cell_index());
+     * @endcode
+     *
+     * Since the quadrature rules are created by @p quadrature_generator, they
+     * are reused on the cells on which the level set function has not
+     * changed if DiscreteQuadratureGenerator::set_cache_tolerance() has been
+     * called. Calling this function again after the level set function has
+     * moved therefore only creates the quadrature rules of the cells the
+     * interface has moved through.
+     */
+    template <int dim, typename Number, typename VectorizedArrayType>
+    void
+    reinit_intersected_cells(
+      const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+      DiscreteQuadratureGenerator<dim>                   &quadrature_generator,
+      MappingInfo<dim, dim, Number>                      *mapping_info_inside,
+      MappingInfo<dim, dim, Number>                      *mapping_info_surface,
+      MappingInfo<dim, dim, Number> *mapping_info_outside = nullptr,
+      const unsigned int             dof_handler_index    = 0);
+
+
+
+#ifndef DOXYGEN
+
+    template <int dim, typename Number, typename VectorizedArrayType>
+    void
+    reinit_intersected_cells(
+      const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+      DiscreteQuadratureGenerator<dim>                   &quadrature_generator,
+      MappingInfo<dim, dim, Number>                      *mapping_info_inside,
+      MappingInfo<dim, dim, Number>                      *mapping_info_surface,
+      MappingInfo<dim, dim, Number>                      *mapping_info_outside,
+      const unsigned int                                  dof_handler_index)
+    {
+      std::vector<typename Triangulation<dim>::active_cell_iterator> cells;
+
+      std::vector<Quadrature<dim>>                inside_quadratures;
+      std::vector<ImmersedSurfaceQuadrature<dim>> surface_quadratures;
+      std::vector<Quadrature<dim>>                outside_quadratures;
+
+      for (unsigned int cell_batch = 0;
+           cell_batch < matrix_free.n_cell_batches();
+           ++cell_batch)
+        if (matrix_free.get_cell_category(cell_batch) ==
+            static_cast<unsigned int>(LocationToLevelSet::intersected))
+          for (unsigned int v = 0;
+               v < matrix_free.n_active_entries_per_cell_batch(cell_batch);
+               ++v)
+            {
+              const typename Triangulation<dim>::active_cell_iterator cell =
+                matrix_free.get_cell_iterator(cell_batch,
+                                              v,
+                                              dof_handler_index);
+              quadrature_generator.generate(cell);
+
+              cells.push_back(cell);
+              if (mapping_info_inside != nullptr)
+                inside_quadratures.push_back(
+                  quadrature_generator.get_inside_quadrature());
+              if (mapping_info_surface != nullptr)
+                surface_quadratures.push_back(
+                  quadrature_generator.get_surface_quadrature());
+              if (mapping_info_outside != nullptr)
+                outside_quadratures.push_back(
+                  quadrature_generator.get_outside_quadrature());
+            }
+
+      const unsigned int n_active_cells =
+        matrix_free.get_dof_handler(dof_handler_index)
+          .get_triangulation()
+          .n_active_cells();
+      if (mapping_info_inside != nullptr)
+        mapping_info_inside->reinit_cells(cells,
+                                          inside_quadratures,
+                                          n_active_cells);
+      if (mapping_info_surface != nullptr)
+        mapping_info_surface->reinit_surface(cells,
+                                             surface_quadratures,
+                                             n_active_cells);
+      if (mapping_info_outside != nullptr)
+        mapping_info_outside->reinit_cells(cells,
+                                           outside_quadratures,
+                                           n_active_cells);
+    }
+
+#endif
+
+  } // namespace MatrixFreeTools
+} // namespace NonMatching
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -152,6 +152,42 @@ namespace NonMatching
       const typename Triangulation<dim>::cell_iterator &cell,
       const unsigned int                                face_index) const;
 
+    /**
+     * Return the LocationToLevelSet of all active cells, converted to
+     * unsigned integers and indexed by the active cell index. The returned
+     * vector can be given to MatrixFree as
+     * MatrixFree::AdditionalData::cell_vectorization_category, so that
+     * MatrixFree groups the cells into batches by their location relative
+     * to the level set function:
+     * @code
+     * typename MatrixFree<dim, double>::AdditionalData data;
+     * data.cell_vectorization_category =
+     *   classifier.get_cell_vectorization_categories();
+     * data.cell_vectorization_categories_strict = true;
+     * matrix_free.reinit(mapping, dof_handler, constraints, quadrature, data);
+     * @endcode
+     * Within a loop over the cell batches, the location of all cells of a
+     * batch is then given by
+     * @code
+     * const LocationToLevelSet location = static_cast<LocationToLevelSet>(
+     *   matrix_free.get_cell_range_category(range));
+     * @endcode
+     * This allows to evaluate the cells inside or outside the domain with
+     * FEEvaluation on the tensor-product quadrature, and to restrict the
+     * evaluation with immersed quadrature rules via FEPointEvaluation to the
+     * batches of intersected cells. The NonMatching::MappingInfo objects for
+     * the latter are set up by
+     * NonMatching::MatrixFreeTools::reinit_intersected_cells().
+     *
+     * @note If AdditionalData::cell_vectorization_categories_strict is not
+     * set, MatrixFree may merge a batch with cells of the next higher
+     * category. Since LocationToLevelSet::intersected is the highest of the
+     * assigned categories, batches with intersected cells are then still
+     * labeled as intersected, but inside and outside cells may be mixed.
+     */
+    std::vector<unsigned int>
+    get_cell_vectorization_categories() const;
+
   private:
     /**
      * For each element in the hp::FECollection returned by
@@ -42,6 +42,9 @@ namespace NonMatching
     {
       template <int dim, int spacedim>
       class QGenerator;
+
+      template <int dim>
+      class QPartitioning;
     } // namespace QuadratureGeneratorImplementation
 
 
@@ -262,7 +265,7 @@ namespace NonMatching
     void
     set_1D_quadrature(const unsigned int q_index);
 
-  private:
+  protected:
     /**
      * QuadratureGenerator is mainly used to start up the recursive
      * algorithm. This is the object that actually generates the quadratures.
@@ -557,6 +560,38 @@ namespace NonMatching
     void
     generate(const typename Triangulation<dim>::active_cell_iterator &cell);
 
+    /**
+     * Enable the reuse of the quadrature rules created by generate() for a
+     * cell in later calls to generate() for the same cell. The stored
+     * quadrature rules are used if the finite element and the 1d quadrature
+     * are the same as before, and if none of the values of the discrete
+     * level set function on the cell differs by more than @p tolerance from
+     * the values the quadrature rules were created for. Otherwise, the
+     * quadrature rules are created anew and stored for later calls.
+     *
+     * This is useful for moving interfaces, where the level set function
+     * only changes on a small part of the cells between two time steps. The
+     * reused quadrature rules belong to a level set function that is
+     * different by up to @p tolerance, so the tolerance should be chosen
+     * well below the accuracy with which the interface needs to be
+     * resolved. A tolerance of zero only reuses the quadrature rules of
+     * cells on which the level set function has not changed at all, whereas
+     * a negative tolerance, which is the default, disables the reuse.
+     *
+     * The stored quadrature rules are indexed by the active cell index, so
+     * clear_cache() should be called after the triangulation has changed to
+     * release the memory of cells that no longer exist.
+     */
+    void
+    set_cache_tolerance(const double tolerance);
+
+    /**
+     * Delete all quadrature rules stored for reuse, see
+     * set_cache_tolerance().
+     */
+    void
+    clear_cache();
+
   private:
     /**
      * Construct immersed quadratures for FE_Q_iso_Q1.
@@ -570,6 +605,52 @@ namespace NonMatching
     std::unique_ptr<internal::DiscreteQuadratureGeneratorImplementation::
                       CellWiseFunction<dim>>
       reference_space_level_set;
+
+    /**
+     * The quadrature rules created for a cell, together with the data they
+     * depend on.
+     */
+    struct CachedQuadratures
+    {
+      /**
+       * The finite element of the level set function on the cell.
+       */
+      const FiniteElement<dim> *fe = nullptr;
+
+      /**
+       * The index of the 1d quadrature the quadrature rules were created
+       * with.
+       */
+      unsigned int q_index = numbers::invalid_unsigned_int;
+
+      /**
+       * The values of the level set function on the cell.
+       */
+      std::vector<double> level_set_values;
+
+      /**
+       * The quadrature rules created for these data.
+       */
+      internal::QuadratureGeneratorImplementation::QPartitioning<dim>
+        quadratures;
+    };
+
+    /**
+     * The maximal difference of the level set values for which stored
+     * quadrature rules are reused, negative if the reuse is disabled.
+     */
+    double cache_tolerance;
+
+    /**
+     * The quadrature rules stored for reuse, indexed by the active cell
+     * index.
+     */
+    std::vector<CachedQuadratures> cache;
+
+    /**
+     * Temporary storage for the level set values of the current cell.
+     */
+    std::vector<double> level_set_values;
   };
 
   /**
@@ -1038,6 +1119,20 @@ namespace NonMatching
         const QPartitioning<dim> &
         get_quadratures() const;
 
+        /**
+         * Replace the constructed quadratures by @p quadratures, e.g., by
+         * quadratures created earlier for the same level set function.
+         */
+        void
+        set_quadratures(const QPartitioning<dim> &quadratures);
+
+        /**
+         * Return the index of the 1d quadrature that is used to create the
+         * quadratures.
+         */
+        unsigned int
+        get_1D_quadrature_index() const;
+
       protected:
         /**
          * Stores options/settings for the algorithm.
@@ -1481,6 +1576,21 @@ namespace NonMatching
          */
         virtual unsigned int
         n_subdivisions() const = 0;
+
+        /**
+         * Return the finite element of the cell passed to the last call of
+         * set_active_cell().
+         */
+        virtual const FiniteElement<dim> &
+        get_fe() const = 0;
+
+        /**
+         * Return the values of the degrees of freedom of the function on the
+         * cell passed to the last call of set_active_cell() in
+         * @p local_dof_values.
+         */
+        virtual void
+        get_local_dof_values(std::vector<double> &local_dof_values) const = 0;
       };
 
     } // namespace DiscreteQuadratureGeneratorImplementation
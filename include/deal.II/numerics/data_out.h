@@ -19,6 +19,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/bounding_box.h>
+
 #include <deal.II/grid/filtered_iterator.h>
 
 #include <deal.II/numerics/data_out_dof_data.h>
@@ -408,6 +410,36 @@ public:
   void
   set_cell_selection(const FilteredIterator<cell_iterator> &filtered_iterator);
 
+  /**
+   * A variation of the previous functions that selects the cells for
+   * inexpensive monitoring output: Only cells whose bounding box intersects
+   * @p region_of_interest are written, and parts of the mesh that are
+   * refined beyond the level @p max_level are represented by their
+   * ancestors on this level, using interpolated values as described in the
+   * documentation of this class. Together with a small number of
+   * subdivisions in build_patches(), this allows to write output of a
+   * region of a large computation frequently at a small fraction of the
+   * cost of the full output.
+   *
+   * In parallel computations, a cell on level @p max_level is only written
+   * if all of its active descendants are
+   * @ref GlossLocallyOwnedCell "locally owned",
+   * and its locally owned active descendants are written instead otherwise.
+   * Each part of the domain is thus written by exactly one process, and
+   * the vectors added to this object only need to provide values on locally
+   * owned cells.
+   *
+   * @note Since non-active cells do not carry data defined on cells, the
+   *   subsampling can only be used if all vectors added to this object
+   *   represent nodal data, unless @p max_level is at least the number of
+   *   levels of the triangulation. The default value of @p max_level does
+   *   not subsample the mesh.
+   */
+  void
+  set_cell_selection(
+    const BoundingBox<spacedim> &region_of_interest,
+    const unsigned int           max_level = numbers::invalid_unsigned_int);
+
   /**
    * Return the two function objects that are in use for determining the first
    * and the next cell as set by set_cell_selection().
@@ -178,6 +178,16 @@ namespace Functions
    * calling value(), gradient(), or similar in a loop over the points you
    * wanted evaluated to find out for which point the call fails.
    *
+   * <h3>Repeated evaluation at the same points</h3>
+   *
+   * This class searches for the cells around the points and evaluates the
+   * shape functions at them in every call. If a sequence of finite element
+   * fields, e.g., the solutions of all time steps, is to be evaluated at
+   * the same set of points, the VectorTools::ProbePoints class is much
+   * cheaper: it does this work only once, works with distributed meshes,
+   * and afterwards only needs a gather of the vector entries and a few small
+   * dense products per point for each evaluation.
+   *
    * @ingroup functions
    */
   template <int dim, typename VectorType = Vector<double>, int spacedim = dim>
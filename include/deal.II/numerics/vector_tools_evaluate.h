@@ -24,8 +24,11 @@
 
 #include <deal.II/dofs/dof_handler.h>
 
+#include <deal.II/fe/fe_values.h>
+
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/vector.h>
+#include <deal.II/lac/vector_element_access.h>
 
 #include <deal.II/matrix_free/fe_point_evaluation.h>
 
@@ -277,6 +280,168 @@ namespace VectorTools
                                      const unsigned int
                                        first_selected_component = 0);
 
+  /**
+   * A fixed set of points ("probes") at which finite element fields defined
+   * on a DoFHandler are evaluated repeatedly, e.g., for monitoring a
+   * solution at the same points in every time step.
+   *
+   * The point_values() function above, like Functions::FEFieldFunction and
+   * VectorTools::point_value(), evaluates the finite element at the
+   * reference coordinates of the points anew in each call. This class does
+   * this work once in reinit(): it locates the points with the help of
+   * Utilities::MPI::RemotePointEvaluation and stores, for every cell that
+   * contains a point, the indices of the degrees of freedom of the cell and
+   * the values of the shape functions at the points. An evaluation with
+   * evaluate() then only consists of gathering the entries of the vector on
+   * these cells, a small dense matrix-vector product per point, and the
+   * communication of the results to the processes that asked for the
+   * points:
+   * @code
+   * VectorTools::ProbePoints<1, dim> probes(mapping, dof_handler, points);
+   *
+   * for (unsigned int step = 0; step < n_steps; ++step)
+   *   {
+   *     // ... compute the solution of the current step ...
+   *
+   *     solution.update_ghost_values();
+   *     const std::vector<double> values = probes.evaluate(solution);
+   *   }
+   * @endcode
+   *
+   * The price for this is memory: for each point and each cell it is
+   * found in, the object stores `n_components` times the number of degrees
+   * of freedom per cell shape function values. If only some components of
+   * a vector-valued finite element are of interest, select them with the
+   * template argument @p n_components and the @p first_selected_component
+   * argument, as for point_values().
+   *
+   * The vector passed to evaluate() needs to provide access to all degrees
+   * of freedom of the locally owned cells, i.e., a parallel vector must have
+   * its ghost values set. As for point_values(), the results for points that
+   * have not been found are undefined, which can be checked with
+   * `get_remote_point_evaluation().all_points_found()`.
+   *
+   * @note The stored data is invalidated if the Triangulation is changed or
+   *   if the degrees of freedom are renumbered or distributed anew; reinit()
+   *   needs to be called again in that case.
+   *
+   * @warning Both reinit() and evaluate() are collective calls that need to
+   *   be executed by all processors in the communicator.
+   */
+  template <int n_components,
+            int dim,
+            int spacedim    = dim,
+            typename Number = double>
+  class ProbePoints
+  {
+  public:
+    /**
+     * The type of the value at a point: a scalar for a single component and
+     * a Tensor of rank one otherwise.
+     */
+    using value_type =
+      typename FEPointEvaluation<n_components, dim, spacedim, Number>::
+        value_type;
+
+    /**
+     * Constructor. The @p additional_data is passed on to the
+     * Utilities::MPI::RemotePointEvaluation object used for locating the
+     * points. Call reinit() before evaluating.
+     */
+    ProbePoints(
+      const typename Utilities::MPI::RemotePointEvaluation<dim, spacedim>::
+        AdditionalData &additional_data =
+          typename Utilities::MPI::RemotePointEvaluation<dim, spacedim>::
+            AdditionalData());
+
+    /**
+     * Constructor, setting up the object for the given points right away.
+     */
+    ProbePoints(
+      const Mapping<dim, spacedim>       &mapping,
+      const DoFHandler<dim, spacedim>    &dof_handler,
+      const std::vector<Point<spacedim>> &points,
+      const unsigned int                  first_selected_component = 0,
+      const typename Utilities::MPI::RemotePointEvaluation<dim, spacedim>::
+        AdditionalData &additional_data =
+          typename Utilities::MPI::RemotePointEvaluation<dim, spacedim>::
+            AdditionalData());
+
+    /**
+     * Locate the given @p points in the mesh of @p dof_handler and compute
+     * the values of the shape functions of components
+     * `[first_selected_component, first_selected_component+n_components)`
+     * at them.
+     */
+    void
+    reinit(const Mapping<dim, spacedim>       &mapping,
+           const DoFHandler<dim, spacedim>    &dof_handler,
+           const std::vector<Point<spacedim>> &points,
+           const unsigned int                  first_selected_component = 0);
+
+    /**
+     * Evaluate the finite element field given by @p vector, which must be
+     * based on the DoFHandler passed to reinit(), at the points. The result
+     * is ordered as the points passed to reinit(). For points found in
+     * several cells, e.g., points on a vertex, the values are combined as
+     * specified by @p flags.
+     */
+    template <typename VectorType>
+    std::vector<value_type>
+    evaluate(const VectorType                      &vector,
+             const EvaluationFlags::EvaluationFlags flags =
+               EvaluationFlags::avg) const;
+
+    /**
+     * Return the number of points passed to reinit().
+     */
+    unsigned int
+    n_points() const;
+
+    /**
+     * Return the object used for locating the points and for the
+     * communication of the results.
+     */
+    const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &
+    get_remote_point_evaluation() const;
+
+  private:
+    /**
+     * The object locating the points and communicating the results.
+     */
+    Utilities::MPI::RemotePointEvaluation<dim, spacedim>
+      remote_point_evaluation;
+
+    /**
+     * The DoFHandler passed to reinit().
+     */
+    ObserverPointer<const DoFHandler<dim, spacedim>> dof_handler;
+
+    /**
+     * The indices of the degrees of freedom of all cells that contain points,
+     * in the order of the cells of
+     * Utilities::MPI::RemotePointEvaluation::CellData.
+     */
+    std::vector<types::global_dof_index> dof_indices;
+
+    /**
+     * The start of the indices of each cell in #dof_indices.
+     */
+    std::vector<unsigned int> dof_index_ptrs;
+
+    /**
+     * The values of the shape functions at the points, for each point
+     * stored as a matrix with one row per selected component and one column
+     * per degree of freedom of the cell.
+     */
+    std::vector<Number> shape_values;
+
+    /**
+     * The start of the shape values of each cell in #shape_values.
+     */
+    std::vector<std::size_t> shape_value_ptrs;
+  };
+
 
 
   // inlined functions
@@ -836,6 +1001,204 @@ namespace VectorTools
       });
   }
 
+
+
+  namespace internal
+  {
+    template <typename Number>
+    void
+    set_component(Number &value, const unsigned int, const Number &entry)
+    {
+      value = entry;
+    }
+
+
+
+    template <int n_components, typename Number>
+    void
+    set_component(Tensor<1, n_components, Number> &value,
+                  const unsigned int               component,
+                  const Number                    &entry)
+    {
+      value[component] = entry;
+    }
+  } // namespace internal
+
+
+
+  template <int n_components, int dim, int spacedim, typename Number>
+  ProbePoints<n_components, dim, spacedim, Number>::ProbePoints(
+    const typename Utilities::MPI::RemotePointEvaluation<dim, spacedim>::
+      AdditionalData &additional_data)
+    : remote_point_evaluation(additional_data)
+  {}
+
+
+
+  template <int n_components, int dim, int spacedim, typename Number>
+  ProbePoints<n_components, dim, spacedim, Number>::ProbePoints(
+    const Mapping<dim, spacedim>       &mapping,
+    const DoFHandler<dim, spacedim>    &dof_handler,
+    const std::vector<Point<spacedim>> &points,
+    const unsigned int                  first_selected_component,
+    const typename Utilities::MPI::RemotePointEvaluation<dim, spacedim>::
+      AdditionalData &additional_data)
+    : remote_point_evaluation(additional_data)
+  {
+    reinit(mapping, dof_handler, points, first_selected_component);
+  }
+
+
+
+  template <int n_components, int dim, int spacedim, typename Number>
+  void
+  ProbePoints<n_components, dim, spacedim, Number>::reinit(
+    const Mapping<dim, spacedim>       &mapping,
+    const DoFHandler<dim, spacedim>    &dof_handler,
+    const std::vector<Point<spacedim>> &points,
+    const unsigned int                  first_selected_component)
+  {
+    remote_point_evaluation.reinit(points,
+                                   dof_handler.get_triangulation(),
+                                   mapping);
+    this->dof_handler = &dof_handler;
+
+    const auto &cell_data = remote_point_evaluation.get_cell_data();
+
+    dof_indices.clear();
+    dof_index_ptrs.assign(1, 0);
+    shape_values.clear();
+    shape_value_ptrs.assign(1, 0);
+
+    std::vector<types::global_dof_index> local_dof_indices;
+    for (const unsigned int i : cell_data.cell_indices())
+      {
+        const auto cell =
+          cell_data.get_active_cell_iterator(i)->as_dof_handler_iterator(
+            dof_handler);
+        const FiniteElement<dim, spacedim> &fe = cell->get_fe();
+        AssertIndexRange(first_selected_component + n_components,
+                         fe.n_components() + 1);
+
+        local_dof_indices.resize(fe.n_dofs_per_cell());
+        cell->get_dof_indices(local_dof_indices);
+        dof_indices.insert(dof_indices.end(),
+                           local_dof_indices.begin(),
+                           local_dof_indices.end());
+        dof_index_ptrs.push_back(dof_indices.size());
+
+        // like Functions::FEFieldFunction, use an FEValues object with the
+        // reference points as quadrature to support all kinds of elements
+        const ArrayView<const Point<dim>> unit_points =
+          cell_data.get_unit_points(i);
+        FEValues<dim, spacedim> fe_values(
+          mapping,
+          fe,
+          Quadrature<dim>(
+            std::vector<Point<dim>>(unit_points.begin(), unit_points.end())),
+          update_values);
+        fe_values.reinit(cell);
+
+        for (const unsigned int q : fe_values.quadrature_point_indices())
+          for (unsigned int c = 0; c < n_components; ++c)
+            for (const unsigned int j : fe_values.dof_indices())
+              shape_values.push_back(
+                fe_values.shape_value_component(j,
+                                                q,
+                                                first_selected_component + c));
+        shape_value_ptrs.push_back(shape_values.size());
+      }
+  }
+
+
+
+  template <int n_components, int dim, int spacedim, typename Number>
+  template <typename VectorType>
+  std::vector<
+    typename ProbePoints<n_components, dim, spacedim, Number>::value_type>
+  ProbePoints<n_components, dim, spacedim, Number>::evaluate(
+    const VectorType                      &vector,
+    const EvaluationFlags::EvaluationFlags flags) const
+  {
+    Assert(remote_point_evaluation.is_ready(),
+           ExcMessage("The ProbePoints object is not ready! Please call "
+                      "reinit() after creating it or after changing the "
+                      "Triangulation."));
+    Assert(dof_handler != nullptr, ExcNotInitialized());
+    AssertDimension(vector.size(), dof_handler->n_dofs());
+
+    const auto evaluation_function =
+      [&](const ArrayView<value_type> &values,
+          const typename Utilities::MPI::RemotePointEvaluation<dim, spacedim>::
+            CellData &cell_data) {
+        std::vector<Number> local_values;
+        for (const unsigned int i : cell_data.cell_indices())
+          {
+            // gather the entries of the vector on the cell
+            const unsigned int dofs_per_cell =
+              dof_index_ptrs[i + 1] - dof_index_ptrs[i];
+            local_values.resize(dofs_per_cell);
+            for (unsigned int j = 0; j < dofs_per_cell; ++j)
+              local_values[j] = ::dealii::internal::ElementAccess<
+                VectorType>::get(vector, dof_indices[dof_index_ptrs[i] + j]);
+
+            // multiply by the shape values of each point
+            const Number *shape_value =
+              shape_values.data() + shape_value_ptrs[i];
+            for (unsigned int q = cell_data.reference_point_ptrs[i];
+                 q < cell_data.reference_point_ptrs[i + 1];
+                 ++q)
+              for (unsigned int c = 0; c < n_components; ++c)
+                {
+                  Number sum = 0;
+                  for (unsigned int j = 0; j < dofs_per_cell;
+                       ++j, ++shape_value)
+                    sum += *shape_value * local_values[j];
+                  internal::set_component(values[q], c, sum);
+                }
+          }
+      };
+
+    std::vector<value_type> evaluation_point_results;
+    std::vector<value_type> buffer;
+    remote_point_evaluation.template evaluate_and_process<value_type>(
+      evaluation_point_results, buffer, evaluation_function);
+
+    if (remote_point_evaluation.is_map_unique())
+      return evaluation_point_results;
+
+    // combine the results of points found in several cells or not at all
+    const auto &ptr = remote_point_evaluation.get_point_ptrs();
+    std::vector<value_type> unique_evaluation_point_results(ptr.size() - 1);
+    for (unsigned int i = 0; i < ptr.size() - 1; ++i)
+      if (ptr[i + 1] > ptr[i])
+        unique_evaluation_point_results[i] =
+          internal::reduce(flags,
+                           ArrayView<const value_type>(
+                             evaluation_point_results.data() + ptr[i],
+                             ptr[i + 1] - ptr[i]));
+    return unique_evaluation_point_results;
+  }
+
+
+
+  template <int n_components, int dim, int spacedim, typename Number>
+  unsigned int
+  ProbePoints<n_components, dim, spacedim, Number>::n_points() const
+  {
+    return remote_point_evaluation.get_point_ptrs().size() - 1;
+  }
+
+
+
+  template <int n_components, int dim, int spacedim, typename Number>
+  const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &
+  ProbePoints<n_components, dim, spacedim, Number>::
+    get_remote_point_evaluation() const
+  {
+    return remote_point_evaluation;
+  }
+
 #endif
 } // namespace VectorTools
 
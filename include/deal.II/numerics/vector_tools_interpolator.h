@@ -0,0 +1,576 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_vector_tools_interpolator_h
+#define dealii_vector_tools_interpolator_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/observer_pointer.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/types.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/component_mask.h>
+#include <deal.II/fe/mapping.h>
+
+#include <deal.II/hp/fe_values.h>
+#include <deal.II/hp/mapping_collection.h>
+#include <deal.II/hp/q_collection.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/vector_element_access.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace VectorTools
+{
+  /**
+   * @name Interpolation and projection
+   */
+  /** @{ */
+
+  /**
+   * A class that interpolates functions into a finite element space many
+   * times on the same mesh, e.g., time-dependent boundary or source data in
+   * every time step.
+   *
+   * VectorTools::interpolate() maps the support points of every cell and
+   * calls Function::vector_value_list() with the few points of a single cell
+   * in every call. This class instead maps the support points once in the
+   * constructor and stores the location of every locally owned degree of
+   * freedom, sorted by vector component. A call to interpolate() then
+   * evaluates the function with a single call to Function::value_list() per
+   * component on all points at once, which lets functions that override
+   * value_list() process long, contiguous batches of points:
+   * @code
+   * VectorTools::Interpolator<dim> interpolator(mapping, dof_handler);
+   *
+   * for (unsigned int step = 0; step < n_steps; ++step)
+   *   {
+   *     function.set_time(step * time_step);
+   *     interpolator.interpolate(function, solution);
+   *     ...
+   *   }
+   * @endcode
+   * The object needs to be recreated whenever the mesh or the degrees of
+   * freedom change.
+   *
+   * The class is restricted to primitive elements with support points, such
+   * as FE_Q, FE_DGQ, or FESystem objects composed of them, where the value
+   * of a degree of freedom is the value of the function at its support
+   * point. Degrees of freedom shared between cells are assigned the support
+   * point of the first locally owned cell they are found on, rather than the
+   * average over all cells computed by VectorTools::interpolate(); both
+   * agree up to roundoff for a continuous mapping.
+   */
+  template <int dim, int spacedim = dim, typename Number = double>
+  class Interpolator
+  {
+  public:
+    /**
+     * Constructor. Computes and stores the mapped support points of the
+     * locally owned degrees of freedom of @p dof_handler.
+     */
+    Interpolator(const Mapping<dim, spacedim>    &mapping,
+                 const DoFHandler<dim, spacedim> &dof_handler);
+
+    /**
+     * Constructor for hp-discretizations.
+     */
+    Interpolator(const hp::MappingCollection<dim, spacedim> &mapping,
+                 const DoFHandler<dim, spacedim>            &dof_handler);
+
+    /**
+     * Interpolate @p function into @p vec, which must have the locally
+     * owned elements of the DoFHandler given to the constructor. Entries
+     * belonging to components not selected by @p component_mask are left
+     * untouched.
+     */
+    template <typename VectorType>
+    void
+    interpolate(const Function<spacedim, Number> &function,
+                VectorType                       &vec,
+                const ComponentMask &component_mask = {}) const;
+
+    /**
+     * Return the number of locally owned degrees of freedom whose support
+     * points are stored.
+     */
+    types::global_dof_index
+    n_points() const;
+
+    /**
+     * Return the support points of all locally owned degrees of freedom of
+     * the given vector @p component.
+     */
+    const std::vector<Point<spacedim>> &
+    get_support_points(const unsigned int component) const;
+
+  private:
+    /**
+     * The mapped support points of the locally owned degrees of freedom,
+     * sorted by vector component.
+     */
+    std::vector<std::vector<Point<spacedim>>> support_points;
+
+    /**
+     * The global index of the degree of freedom at each of the points in
+     * support_points.
+     */
+    std::vector<std::vector<types::global_dof_index>> dof_indices;
+
+    /**
+     * Scratch array for the function values at the points of one component.
+     */
+    mutable std::vector<Number> values;
+  };
+
+
+
+  /**
+   * A class that computes the $L_2$ projection of functions onto a finite
+   * element space many times on the same mesh, e.g., time-dependent data in
+   * every time step.
+   *
+   * VectorTools::project() sets up a MatrixFree object and the diagonal of
+   * the mass matrix used as preconditioner, and evaluates the function with
+   * one call per cell, in every call. This class performs the setup in the
+   * constructor: It initializes the MatrixFree object, the mass operator
+   * and its diagonal, stores the locations of all quadrature points of the
+   * locally owned cells as well as the contribution of inhomogeneous
+   * constraints to the right hand side. A call to project() then evaluates
+   * the function with a single call to Function::value_list() per component
+   * on all quadrature points, assembles the right hand side with
+   * FEEvaluation, and solves the mass matrix system with a matrix-free
+   * conjugate gradient method:
+   * @code
+   * VectorTools::Projector<dim> projector(mapping,
+   *                                       dof_handler,
+   *                                       constraints,
+   *                                       QGauss<1>(fe.degree + 2));
+   *
+   * LinearAlgebra::distributed::Vector<double> projection;
+   * projector.initialize_dof_vector(projection);
+   * for (unsigned int step = 0; step < n_steps; ++step)
+   *   {
+   *     function.set_time(step * time_step);
+   *     projector.project(function, projection);
+   *     ...
+   *   }
+   * @endcode
+   * The object needs to be recreated whenever the mesh, the degrees of
+   * freedom, or the constraints change.
+   *
+   * Since the function is evaluated on all quadrature points at once, the
+   * object stores the locations of all quadrature points of the locally
+   * owned cells, and project() keeps the function values of all of them,
+   * i.e., `n_q_points_total * dim` doubles for the points plus
+   * `n_q_points_total * n_components` numbers for the values, where
+   * `n_q_points_total` is the number of quadrature points per cell times
+   * the number of locally owned cells. This is typically several times the
+   * size of a solution vector.
+   *
+   * @tparam dim The dimension of the mesh.
+   * @tparam n_components The number of vector components of the finite
+   * element.
+   * @tparam Number The scalar type of the vectors.
+   */
+  template <int dim, int n_components = 1, typename Number = double>
+  class Projector
+  {
+  public:
+    /**
+     * The vector type the projection is computed in.
+     */
+    using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+    /**
+     * Constructor. The constraints, which typically contain hanging node
+     * constraints and possibly boundary conditions, are applied to the
+     * projection; the object must stay alive as long as this class is used.
+     */
+    Projector(const Mapping<dim>              &mapping,
+              const DoFHandler<dim>           &dof_handler,
+              const AffineConstraints<Number> &constraints,
+              const Quadrature<1>             &quadrature);
+
+    /**
+     * Initialize @p vec with the parallel layout of the projection.
+     */
+    void
+    initialize_dof_vector(VectorType &vec) const;
+
+    /**
+     * Compute the $L_2$ projection of @p function and store it in @p vec,
+     * which needs to be initialized by initialize_dof_vector(). The
+     * projection is computed to a relative accuracy of @p tolerance.
+     */
+    void
+    project(const Function<dim, Number> &function,
+            VectorType                  &vec,
+            const double                 tolerance = 1e-12) const;
+
+    /**
+     * Return the underlying MatrixFree object.
+     */
+    const MatrixFree<dim, Number> &
+    get_matrix_free() const;
+
+  private:
+    /**
+     * The constraints applied to the projection.
+     */
+    ObserverPointer<const AffineConstraints<Number>> constraints;
+
+    /**
+     * The MatrixFree object holding the mapping data.
+     */
+    std::shared_ptr<MatrixFree<dim, Number>> matrix_free;
+
+    /**
+     * The mass operator, including the inverse of its diagonal.
+     */
+    MatrixFreeOperators::MassOperator<dim, -1, 0, n_components, VectorType>
+      mass_matrix;
+
+    /**
+     * The locations of the quadrature points of all cell batches. The
+     * points of cell batch @p b start at index
+     * <tt>point_offsets[b]</tt> and are stored for one quadrature point after
+     * the other, with the points of all filled lanes of the batch next to
+     * each other.
+     */
+    std::vector<Point<dim>> quadrature_points;
+
+    /**
+     * The index of the first quadrature point of each cell batch in
+     * quadrature_points.
+     */
+    std::vector<unsigned int> point_offsets;
+
+    /**
+     * The contribution of the inhomogeneous constraints to the right hand
+     * side.
+     */
+    VectorType inhomogeneity_rhs;
+
+    /**
+     * Scratch data for the function values at the quadrature points and for
+     * the right hand side.
+     */
+    mutable std::vector<std::vector<Number>> values;
+    mutable VectorType                       rhs;
+  };
+
+  /** @} */
+
+
+
+#ifndef DOXYGEN
+
+  /*---------------------- Inline functions: Interpolator --------------------*/
+
+
+
+  template <int dim, int spacedim, typename Number>
+  Interpolator<dim, spacedim, Number>::Interpolator(
+    const Mapping<dim, spacedim>    &mapping,
+    const DoFHandler<dim, spacedim> &dof_handler)
+    : Interpolator(hp::MappingCollection<dim, spacedim>(mapping), dof_handler)
+  {}
+
+
+
+  template <int dim, int spacedim, typename Number>
+  Interpolator<dim, spacedim, Number>::Interpolator(
+    const hp::MappingCollection<dim, spacedim> &mapping,
+    const DoFHandler<dim, spacedim>            &dof_handler)
+  {
+    const hp::FECollection<dim, spacedim> &fe =
+      dof_handler.get_fe_collection();
+
+    hp::QCollection<dim> support_quadrature;
+    for (unsigned int fe_index = 0; fe_index < fe.size(); ++fe_index)
+      {
+        Assert(fe[fe_index].is_primitive() &&
+                 (fe[fe_index].n_dofs_per_cell() == 0 ||
+                  fe[fe_index].has_support_points()),
+               ExcMessage("The Interpolator class requires primitive finite "
+                          "elements with support points."));
+        support_quadrature.push_back(
+          Quadrature<dim>(fe[fe_index].get_unit_support_points()));
+      }
+
+    hp::FEValues<dim, spacedim> fe_values(mapping,
+                                          fe,
+                                          support_quadrature,
+                                          update_quadrature_points);
+
+    const IndexSet   &locally_owned_dofs = dof_handler.locally_owned_dofs();
+    std::vector<bool> dof_found(locally_owned_dofs.n_elements(), false);
+
+    support_points.resize(fe.n_components());
+    dof_indices.resize(fe.n_components());
+
+    std::vector<types::global_dof_index> dofs_on_cell(fe.max_dofs_per_cell());
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (cell->is_locally_owned() && cell->get_fe().n_dofs_per_cell() > 0)
+        {
+          fe_values.reinit(cell);
+          const std::vector<Point<spacedim>> &points =
+            fe_values.get_present_fe_values().get_quadrature_points();
+
+          const FiniteElement<dim, spacedim> &cell_fe = cell->get_fe();
+          dofs_on_cell.resize(cell_fe.n_dofs_per_cell());
+          cell->get_dof_indices(dofs_on_cell);
+          for (unsigned int i = 0; i < cell_fe.n_dofs_per_cell(); ++i)
+            if (locally_owned_dofs.is_element(dofs_on_cell[i]))
+              {
+                const types::global_dof_index index =
+                  locally_owned_dofs.index_within_set(dofs_on_cell[i]);
+                if (dof_found[index])
+                  continue;
+                dof_found[index] = true;
+
+                const unsigned int component =
+                  cell_fe.system_to_component_index(i).first;
+                support_points[component].push_back(points[i]);
+                dof_indices[component].push_back(dofs_on_cell[i]);
+              }
+        }
+  }
+
+
+
+  template <int dim, int spacedim, typename Number>
+  template <typename VectorType>
+  void
+  Interpolator<dim, spacedim, Number>::interpolate(
+    const Function<spacedim, Number> &function,
+    VectorType                       &vec,
+    const ComponentMask              &component_mask) const
+  {
+    AssertDimension(function.n_components, support_points.size());
+    Assert(component_mask.represents_n_components(support_points.size()),
+           ExcMessage("The number of components in the mask has to be either "
+                      "zero or equal to the number of components in the "
+                      "finite element."));
+
+    for (unsigned int c = 0; c < support_points.size(); ++c)
+      if (component_mask[c] && !support_points[c].empty())
+        {
+          values.resize(support_points[c].size());
+          function.value_list(support_points[c], values, c);
+          for (unsigned int i = 0; i < values.size(); ++i)
+            ::dealii::internal::ElementAccess<VectorType>::set(
+              values[i], dof_indices[c][i], vec);
+        }
+    vec.compress(VectorOperation::insert);
+  }
+
+
+
+  template <int dim, int spacedim, typename Number>
+  inline types::global_dof_index
+  Interpolator<dim, spacedim, Number>::n_points() const
+  {
+    types::global_dof_index n = 0;
+    for (const auto &points : support_points)
+      n += points.size();
+    return n;
+  }
+
+
+
+  template <int dim, int spacedim, typename Number>
+  inline const std::vector<Point<spacedim>> &
+  Interpolator<dim, spacedim, Number>::get_support_points(
+    const unsigned int component) const
+  {
+    AssertIndexRange(component, support_points.size());
+    return support_points[component];
+  }
+
+
+
+  /*----------------------- Inline functions: Projector ----------------------*/
+
+
+
+  template <int dim, int n_components, typename Number>
+  Projector<dim, n_components, Number>::Projector(
+    const Mapping<dim>              &mapping,
+    const DoFHandler<dim>           &dof_handler,
+    const AffineConstraints<Number> &constraints,
+    const Quadrature<1>             &quadrature)
+    : constraints(&constraints)
+    , matrix_free(std::make_shared<MatrixFree<dim, Number>>())
+    , values(n_components)
+  {
+    AssertDimension(dof_handler.get_fe().n_components(), n_components);
+
+    typename MatrixFree<dim, Number>::AdditionalData additional_data;
+    additional_data.tasks_parallel_scheme =
+      MatrixFree<dim, Number>::AdditionalData::none;
+    additional_data.mapping_update_flags =
+      update_values | update_JxW_values | update_quadrature_points;
+    matrix_free->reinit(
+      mapping, dof_handler, constraints, quadrature, additional_data);
+
+    mass_matrix.initialize(matrix_free);
+    mass_matrix.compute_diagonal();
+
+    FEEvaluation<dim, -1, 0, n_components, Number> phi(*matrix_free);
+
+    // store the quadrature points of the filled lanes of all cell batches
+    point_offsets.resize(matrix_free->n_cell_batches() + 1);
+    point_offsets[0] = 0;
+    for (unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+      {
+        phi.reinit(cell);
+        const unsigned int n_lanes =
+          matrix_free->n_active_entries_per_cell_batch(cell);
+        for (const unsigned int q : phi.quadrature_point_indices())
+          {
+            const auto point = phi.quadrature_point(q);
+            for (unsigned int v = 0; v < n_lanes; ++v)
+              {
+                Point<dim> p;
+                for (unsigned int d = 0; d < dim; ++d)
+                  p[d] = point[d][v];
+                quadrature_points.push_back(p);
+              }
+          }
+        point_offsets[cell + 1] = quadrature_points.size();
+      }
+
+    // the constrained values enter the right hand side through the
+    // negative mass matrix applied to them
+    VectorType inhomogeneities;
+    matrix_free->initialize_dof_vector(inhomogeneities);
+    matrix_free->initialize_dof_vector(inhomogeneity_rhs);
+    matrix_free->initialize_dof_vector(rhs);
+    constraints.distribute(inhomogeneities);
+    inhomogeneities *= -1.;
+    inhomogeneities.update_ghost_values();
+    for (unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+      {
+        phi.reinit(cell);
+        phi.read_dof_values_plain(inhomogeneities);
+        phi.evaluate(::dealii::EvaluationFlags::values);
+        for (const unsigned int q : phi.quadrature_point_indices())
+          phi.submit_value(phi.get_value(q), q);
+        phi.integrate(::dealii::EvaluationFlags::values);
+        phi.distribute_local_to_global(inhomogeneity_rhs);
+      }
+    inhomogeneity_rhs.compress(VectorOperation::add);
+  }
+
+
+
+  template <int dim, int n_components, typename Number>
+  inline void
+  Projector<dim, n_components, Number>::initialize_dof_vector(
+    VectorType &vec) const
+  {
+    matrix_free->initialize_dof_vector(vec);
+  }
+
+
+
+  template <int dim, int n_components, typename Number>
+  void
+  Projector<dim, n_components, Number>::project(
+    const Function<dim, Number> &function,
+    VectorType                  &vec,
+    const double                 tolerance) const
+  {
+    AssertDimension(function.n_components, n_components);
+    Assert(vec.partitioners_are_compatible(
+             *matrix_free->get_dof_info().vector_partitioner),
+           ExcMessage("The vector has not been initialized with "
+                      "initialize_dof_vector()."));
+
+    for (unsigned int c = 0; c < n_components; ++c)
+      {
+        values[c].resize(quadrature_points.size());
+        function.value_list(quadrature_points, values[c], c);
+      }
+
+    rhs = inhomogeneity_rhs;
+    FEEvaluation<dim, -1, 0, n_components, Number> phi(*matrix_free);
+    for (unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+      {
+        phi.reinit(cell);
+        const unsigned int n_lanes =
+          matrix_free->n_active_entries_per_cell_batch(cell);
+        unsigned int index = point_offsets[cell];
+        for (const unsigned int q : phi.quadrature_point_indices())
+          {
+            typename FEEvaluation<dim, -1, 0, n_components, Number>::value_type
+              value = {};
+            for (unsigned int v = 0; v < n_lanes; ++v, ++index)
+              if constexpr (n_components == 1)
+                value[v] = values[0][index];
+              else
+                for (unsigned int c = 0; c < n_components; ++c)
+                  value[c][v] = values[c][index];
+            phi.submit_value(value, q);
+          }
+        phi.integrate_scatter(::dealii::EvaluationFlags::values, rhs);
+      }
+    rhs.compress(VectorOperation::add);
+
+    ReductionControl control(6 * rhs.size(), 0., tolerance, false, false);
+    SolverCG<VectorType> cg(control);
+    vec = Number();
+    cg.solve(mass_matrix,
+             vec,
+             rhs,
+             *mass_matrix.get_matrix_diagonal_inverse());
+
+    constraints->distribute(vec);
+  }
+
+
+
+  template <int dim, int n_components, typename Number>
+  inline const MatrixFree<dim, Number> &
+  Projector<dim, n_components, Number>::get_matrix_free() const
+  {
+    return *matrix_free;
+  }
+
+#endif
+
+} // namespace VectorTools
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -293,7 +293,8 @@ namespace VectorTools
    * offers at least some optimizations. On the other hand, if you
    * want to evaluate <i>many solutions</i> at the same point, you may
    * want to look at the VectorTools::create_point_source_vector()
-   * function.
+   * function, or at the VectorTools::ProbePoints class if you want to
+   * evaluate many solutions at the same set of many points.
    *
    * @note If the cell in which the point is found is not locally owned, an
    *   exception of type VectorTools::ExcPointNotAvailableHere is thrown.
@@ -363,7 +364,8 @@ namespace VectorTools
    * offers at least some optimizations. On the other hand, if you
    * want to evaluate <i>many solutions</i> at the same point, you may
    * want to look at the VectorTools::create_point_source_vector()
-   * function.
+   * function, or at the VectorTools::ProbePoints class if you want to
+   * evaluate many solutions at the same set of many points.
    *
    * This function is used in the "Possibilities for extensions" part of the
    * results section of
@@ -436,7 +438,8 @@ namespace VectorTools
    * offers at least some optimizations. On the other hand, if you
    * want to evaluate <i>many solutions</i> at the same point, you may
    * want to look at the VectorTools::create_point_source_vector()
-   * function.
+   * function, or at the VectorTools::ProbePoints class if you want to
+   * evaluate many solutions at the same set of many points.
    *
    * @note If the cell in which the point is found is not locally owned, an
    * exception of type VectorTools::ExcPointNotAvailableHere is thrown.
@@ -506,7 +509,8 @@ namespace VectorTools
    * offers at least some optimizations. On the other hand, if you
    * want to evaluate <i>many solutions</i> at the same point, you may
    * want to look at the VectorTools::create_point_source_vector()
-   * function.
+   * function, or at the VectorTools::ProbePoints class if you want to
+   * evaluate many solutions at the same set of many points.
    *
    * @note If the cell in which the point is found is not locally owned, an
    * exception of type VectorTools::ExcPointNotAvailableHere is thrown.
@@ -197,6 +197,36 @@ namespace
 
 
 
+  /**
+   * Round the given floating point numbers to @p n_significant_bits bits of
+   * their mantissa and set the remaining bits to zero. This reduces the
+   * precision of the data, but makes it much better compressible.
+   */
+  void
+  round_to_significant_bits(std::vector<float> &data,
+                            const unsigned int  n_significant_bits)
+  {
+    constexpr unsigned int n_mantissa_bits =
+      std::numeric_limits<float>::digits - 1;
+    if (n_significant_bits >= n_mantissa_bits)
+      return;
+
+    const unsigned int  n_dropped_bits = n_mantissa_bits - n_significant_bits;
+    const std::uint32_t half           = std::uint32_t(1)
+                               << (n_dropped_bits - 1);
+    const std::uint32_t mask = ~((std::uint32_t(1) << n_dropped_bits) - 1);
+    for (float &value : data)
+      if (std::isfinite(value))
+        {
+          std::uint32_t bits;
+          std::memcpy(&bits, &value, sizeof(float));
+          bits = (bits + half) & mask;
+          std::memcpy(&value, &bits, sizeof(float));
+        }
+  }
+
+
+
   /**
    * Convert an array of data objects into a string that will form part of
    * what we then output as data into VTU objects.
@@ -2407,11 +2437,25 @@ namespace DataOutBase
   }
 
 
-  Hdf5Flags::Hdf5Flags(const CompressionLevel compression_level)
+  Hdf5Flags::Hdf5Flags(const CompressionLevel compression_level,
+                       const std::uint64_t    chunk_size,
+                       const bool             shuffle,
+                       const std::string     &solution_group)
     : compression_level(compression_level)
+    , chunk_size(chunk_size)
+    , shuffle(shuffle)
+    , solution_group(solution_group)
   {}
 
 
+
+  std::size_t
+  Hdf5Flags::memory_consumption() const
+  {
+    return sizeof(*this) + MemoryConsumption::memory_consumption(solution_group);
+  }
+
+
   TecplotFlags::TecplotFlags(const char *zone_name, const double solution_time)
     : zone_name(zone_name)
     , solution_time(solution_time)
@@ -2432,13 +2476,15 @@ namespace DataOutBase
                      const bool             print_date_and_time,
                      const CompressionLevel compression_level,
                      const bool             write_higher_order_cells,
-                     const std::map<std::string, std::string> &physical_units)
+                     const std::map<std::string, std::string> &physical_units,
+                     const std::map<std::string, unsigned int> &significant_bits)
     : time(time)
     , cycle(cycle)
     , print_date_and_time(print_date_and_time)
     , compression_level(compression_level)
     , write_higher_order_cells(write_higher_order_cells)
     , physical_units(physical_units)
+    , significant_bits(significant_bits)
   {}
 
 
@@ -5990,6 +6036,13 @@ namespace DataOutBase
               }
           } // loop over nodes
 
+        // reduce the precision if requested, again looking up either the
+        // name of the whole vector/tensor or of its first component
+        const auto significant_bits = flags.significant_bits.find(
+          !name.empty() ? name : data_names[first_component]);
+        if (significant_bits != flags.significant_bits.end())
+          round_to_significant_bits(data, significant_bits->second);
+
         o << vtu_stringize_array(data,
                                  flags.compression_level,
                                  output_precision);
@@ -6017,8 +6070,13 @@ namespace DataOutBase
 
         o << ">\n";
 
-        const std::vector<float> data(data_vectors[data_set].begin(),
-                                      data_vectors[data_set].end());
+        std::vector<float> data(data_vectors[data_set].begin(),
+                                data_vectors[data_set].end());
+        const auto significant_bits =
+          flags.significant_bits.find(data_names[data_set]);
+        if (significant_bits != flags.significant_bits.end())
+          round_to_significant_bits(data, significant_bits->second);
+
         o << vtu_stringize_array(data,
                                  flags.compression_level,
                                  output_precision);
@@ -8079,7 +8137,8 @@ DataOutInterface<dim, spacedim>::create_xdmf_entry(
                       global_node_cell_count[1],
                       dim,
                       spacedim,
-                      patches[0].reference_cell);
+                      patches[0].reference_cell,
+                      hdf5_flags.solution_group);
       const unsigned int n_data_sets = data_filter.n_data_sets();
 
       // The vector names generated here must match those generated in
@@ -8190,9 +8249,76 @@ DataOutInterface<dim, spacedim>::write_filtered_data(
 }
 
 
+
+template <int dim, int spacedim>
+std::vector<DataOutBase::FieldStatistics>
+DataOutInterface<dim, spacedim>::compute_field_statistics(
+  const unsigned int n_histogram_intervals,
+  const MPI_Comm     comm) const
+{
+  return DataOutBase::compute_field_statistics(get_patches(),
+                                               get_dataset_names(),
+                                               n_histogram_intervals,
+                                               comm);
+}
+
+
 namespace
 {
 #ifdef DEAL_II_WITH_HDF5
+  /**
+   * Create the property list for a two-dimensional dataset with the global
+   * size @p dims, whose entries have @p entry_size bytes, and set up
+   * chunking and compression as requested by @p flags.
+   */
+  hid_t
+  create_hdf5_dataset_properties(const DataOutBase::Hdf5Flags &flags,
+                                 const hsize_t                *dims,
+                                 const std::size_t             entry_size)
+  {
+    const hid_t properties = H5Pcreate(H5P_DATASET_CREATE);
+    AssertThrow(properties >= 0, ExcIO());
+
+#  ifdef DEAL_II_WITH_ZLIB
+    // HDF5 can only compress chunked datasets, and chunks must not be empty
+    if (flags.compression_level !=
+          DataOutBase::CompressionLevel::no_compression &&
+        flags.compression_level != DataOutBase::CompressionLevel::plain_text &&
+        dims[0] > 0)
+      {
+        // unless told otherwise, use chunks of about one megabyte: large
+        // enough for a good compression ratio, but small enough that the
+        // processes of a parallel write mostly touch different chunks
+        const std::uint64_t chunk_rows =
+          (flags.chunk_size > 0) ?
+            flags.chunk_size :
+            std::max<std::uint64_t>((1 << 20) / (entry_size * dims[1]), 1);
+        const hsize_t chunk_dims[2] = {std::min<hsize_t>(dims[0], chunk_rows),
+                                       dims[1]};
+
+        herr_t status = H5Pset_chunk(properties, 2, chunk_dims);
+        AssertThrow(status >= 0, ExcIO());
+        if (flags.shuffle)
+          {
+            status = H5Pset_shuffle(properties);
+            AssertThrow(status >= 0, ExcIO());
+          }
+        status = H5Pset_deflate(properties,
+                                get_zlib_compression_level(
+                                  flags.compression_level));
+        AssertThrow(status >= 0, ExcIO());
+      }
+#  else
+    (void)flags;
+    (void)dims;
+    (void)entry_size;
+#  endif
+
+    return properties;
+  }
+
+
+
   /**
    * Helper function to actually perform the HDF5 output.
    */
@@ -8206,7 +8332,8 @@ namespace
                 const std::string                &solution_filename,
                 const MPI_Comm                    comm)
   {
-    hid_t h5_mesh_file_id = -1, h5_solution_file_id, file_plist_id, plist_id;
+    hid_t h5_mesh_file_id = -1, h5_solution_file_id, h5_solution_group_id,
+          file_plist_id, plist_id;
     hid_t node_dataspace, node_dataset, node_file_dataspace,
       node_memory_dataspace, node_dataset_id;
     hid_t cell_dataspace, cell_dataset, cell_file_dataspace,
@@ -8235,11 +8362,6 @@ namespace
     AssertThrow(status >= 0, ExcIO());
 #    endif
 #  endif
-    // if zlib support is disabled flags are unused
-#  ifndef DEAL_II_WITH_ZLIB
-    (void)flags;
-#  endif
-
     // Compute the global total number of nodes/cells and determine the offset
     // of the data for this process
 
@@ -8307,12 +8429,8 @@ namespace
                                  node_dataspace,
                                  H5P_DEFAULT);
 #  else
-        node_dataset_id = H5Pcreate(H5P_DATASET_CREATE);
-#    ifdef DEAL_II_WITH_ZLIB
-        H5Pset_deflate(node_dataset_id,
-                       get_zlib_compression_level(flags.compression_level));
-        H5Pset_chunk(node_dataset_id, 2, node_ds_dim);
-#    endif
+        node_dataset_id =
+          create_hdf5_dataset_properties(flags, node_ds_dim, sizeof(double));
         node_dataset = H5Dcreate(h5_mesh_file_id,
                                  "nodes",
                                  H5T_NATIVE_DOUBLE,
@@ -8330,12 +8448,9 @@ namespace
                                  cell_dataspace,
                                  H5P_DEFAULT);
 #  else
-        node_dataset_id = H5Pcreate(H5P_DATASET_CREATE);
-#    ifdef DEAL_II_WITH_ZLIB
-        H5Pset_deflate(node_dataset_id,
-                       get_zlib_compression_level(flags.compression_level));
-        H5Pset_chunk(node_dataset_id, 2, cell_ds_dim);
-#    endif
+        node_dataset_id = create_hdf5_dataset_properties(flags,
+                                                         cell_ds_dim,
+                                                         sizeof(unsigned int));
         cell_dataset = H5Dcreate(h5_mesh_file_id,
                                  "cells",
                                  H5T_NATIVE_UINT,
@@ -8440,14 +8555,64 @@ namespace
       }
     else
       {
-        // Otherwise we need to open a new file
-        h5_solution_file_id = H5Fcreate(solution_filename.c_str(),
-                                        H5F_ACC_TRUNC,
-                                        H5P_DEFAULT,
-                                        file_plist_id);
+        // Otherwise we need to open a new file, unless we add a group to an
+        // existing solution file
+        bool append_to_file = false;
+        if (!flags.solution_group.empty())
+          {
+            if (Utilities::MPI::this_mpi_process(comm) == 0)
+              append_to_file =
+                std::ifstream(solution_filename).good() &&
+#  if H5_VERSION_GE(1, 12, 0)
+                (H5Fis_accessible(solution_filename.c_str(), H5P_DEFAULT) >
+                 0);
+#  else
+                (H5Fis_hdf5(solution_filename.c_str()) > 0);
+#  endif
+            append_to_file = Utilities::MPI::broadcast(comm, append_to_file, 0);
+          }
+
+        if (append_to_file)
+          h5_solution_file_id =
+            H5Fopen(solution_filename.c_str(), H5F_ACC_RDWR, file_plist_id);
+        else
+          h5_solution_file_id = H5Fcreate(solution_filename.c_str(),
+                                          H5F_ACC_TRUNC,
+                                          H5P_DEFAULT,
+                                          file_plist_id);
         AssertThrow(h5_solution_file_id >= 0, ExcIO());
       }
 
+    // Put the solution datasets into the requested group, replacing a group
+    // of the same name that might have been written before. Note that
+    // H5Ldelete only removes the link to the old group; the space of its
+    // datasets is not reclaimed
+    if (flags.solution_group.empty())
+      h5_solution_group_id = h5_solution_file_id;
+    else
+      {
+        if (H5Lexists(h5_solution_file_id,
+                      flags.solution_group.c_str(),
+                      H5P_DEFAULT) > 0)
+          {
+            status = H5Ldelete(h5_solution_file_id,
+                               flags.solution_group.c_str(),
+                               H5P_DEFAULT);
+            AssertThrow(status >= 0, ExcIO());
+          }
+#  if H5Gcreate_vers == 1
+        h5_solution_group_id =
+          H5Gcreate(h5_solution_file_id, flags.solution_group.c_str(), 0);
+#  else
+        h5_solution_group_id = H5Gcreate(h5_solution_file_id,
+                                         flags.solution_group.c_str(),
+                                         H5P_DEFAULT,
+                                         H5P_DEFAULT,
+                                         H5P_DEFAULT);
+#  endif
+        AssertThrow(h5_solution_group_id >= 0, ExcIO());
+      }
+
     // when writing, first write out all vector data, then handle the scalar
     // data sets that have been left over
     unsigned int i;
@@ -8466,19 +8631,15 @@ namespace
         AssertThrow(pt_data_dataspace >= 0, ExcIO());
 
 #  if H5Gcreate_vers == 1
-        pt_data_dataset = H5Dcreate(h5_solution_file_id,
+        pt_data_dataset = H5Dcreate(h5_solution_group_id,
                                     vector_name.c_str(),
                                     H5T_NATIVE_DOUBLE,
                                     pt_data_dataspace,
                                     H5P_DEFAULT);
 #  else
-        node_dataset_id = H5Pcreate(H5P_DATASET_CREATE);
-#    ifdef DEAL_II_WITH_ZLIB
-        H5Pset_deflate(node_dataset_id,
-                       get_zlib_compression_level(flags.compression_level));
-        H5Pset_chunk(node_dataset_id, 2, node_ds_dim);
-#    endif
-        pt_data_dataset = H5Dcreate(h5_solution_file_id,
+        node_dataset_id =
+          create_hdf5_dataset_properties(flags, node_ds_dim, sizeof(double));
+        pt_data_dataset = H5Dcreate(h5_solution_group_id,
                                     vector_name.c_str(),
                                     H5T_NATIVE_DOUBLE,
                                     pt_data_dataspace,
@@ -8537,7 +8698,12 @@ namespace
     status = H5Pclose(plist_id);
     AssertThrow(status >= 0, ExcIO());
 
-    // Close the file
+    // Close the group and the file
+    if (h5_solution_group_id != h5_solution_file_id)
+      {
+        status = H5Gclose(h5_solution_group_id);
+        AssertThrow(status >= 0, ExcIO());
+      }
     status = H5Fclose(h5_solution_file_id);
     AssertThrow(status >= 0, ExcIO());
   }
@@ -8546,6 +8712,110 @@ namespace
 
 
 
+template <int dim, int spacedim>
+std::vector<DataOutBase::FieldStatistics>
+DataOutBase::compute_field_statistics(
+  const std::vector<Patch<dim, spacedim>> &patches,
+  const std::vector<std::string>          &data_names,
+  const unsigned int                       n_histogram_intervals,
+  const MPI_Comm                           comm)
+{
+  const unsigned int n_data_sets = data_names.size();
+
+  // In a first pass, compute the extrema and sums of all quantities, skipping
+  // values that are not finite. The numbers of these values and the number
+  // of points are appended to the sums to get away with a single reduction
+  std::vector<double> min_values(n_data_sets,
+                                 std::numeric_limits<double>::max());
+  std::vector<double> max_values(n_data_sets,
+                                 std::numeric_limits<double>::lowest());
+  std::vector<double> sums(2 * n_data_sets + 1, 0.);
+  for (const auto &patch : patches)
+    {
+      if (n_data_sets == 0)
+        break;
+
+      Assert(patch.data.n_rows() ==
+               n_data_sets + (patch.points_are_available ? spacedim : 0),
+             ExcDimensionMismatch(patch.data.n_rows(),
+                                  n_data_sets + (patch.points_are_available ?
+                                                   spacedim :
+                                                   0)));
+      for (unsigned int i = 0; i < n_data_sets; ++i)
+        for (unsigned int q = 0; q < patch.data.n_cols(); ++q)
+          {
+            const double value = patch.data(i, q);
+            if (std::isfinite(value))
+              {
+                min_values[i] = std::min(min_values[i], value);
+                max_values[i] = std::max(max_values[i], value);
+                sums[i] += value;
+              }
+            else
+              sums[n_data_sets + i] += 1.;
+          }
+      sums[2 * n_data_sets] += patch.data.n_cols();
+    }
+
+  Utilities::MPI::min(min_values, comm, min_values);
+  Utilities::MPI::max(max_values, comm, max_values);
+  Utilities::MPI::sum(sums, comm, sums);
+
+  std::vector<FieldStatistics> statistics(n_data_sets);
+  for (unsigned int i = 0; i < n_data_sets; ++i)
+    {
+      statistics[i].name = data_names[i];
+      statistics[i].n_points =
+        static_cast<std::uint64_t>(sums[2 * n_data_sets]);
+      statistics[i].n_non_finite_values =
+        static_cast<std::uint64_t>(sums[n_data_sets + i]);
+      if (statistics[i].n_points > statistics[i].n_non_finite_values)
+        {
+          statistics[i].min_value = min_values[i];
+          statistics[i].max_value = max_values[i];
+          statistics[i].mean_value =
+            sums[i] / (sums[2 * n_data_sets] - sums[n_data_sets + i]);
+        }
+    }
+
+  if (n_histogram_intervals == 0)
+    return statistics;
+
+  // In a second pass, sort the values into the intervals between the global
+  // extrema
+  std::vector<std::uint64_t> counts(n_data_sets * n_histogram_intervals, 0);
+  for (const auto &patch : patches)
+    for (unsigned int i = 0; i < n_data_sets; ++i)
+      {
+        const double width =
+          (statistics[i].max_value - statistics[i].min_value) /
+          n_histogram_intervals;
+        for (unsigned int q = 0; q < patch.data.n_cols(); ++q)
+          if (std::isfinite(patch.data(i, q)))
+            {
+              const unsigned int interval =
+                (width > 0.) ?
+                  std::min(static_cast<unsigned int>(
+                             (patch.data(i, q) - statistics[i].min_value) /
+                             width),
+                           n_histogram_intervals - 1) :
+                  0;
+              ++counts[i * n_histogram_intervals + interval];
+            }
+      }
+
+  Utilities::MPI::sum(counts, comm, counts);
+
+  for (unsigned int i = 0; i < n_data_sets; ++i)
+    statistics[i].histogram.assign(counts.begin() + i * n_histogram_intervals,
+                                   counts.begin() +
+                                     (i + 1) * n_histogram_intervals);
+
+  return statistics;
+}
+
+
+
 template <int dim, int spacedim>
 void
 DataOutBase::write_filtered_data(
@@ -9401,6 +9671,7 @@ DataOutReader<dim, spacedim>::get_nonscalar_data_ranges() const
 XDMFEntry::XDMFEntry()
   : valid(false)
   , h5_sol_filename("")
+  , h5_sol_group("")
   , h5_mesh_filename("")
   , entry_time(0.0)
   , num_nodes(numbers::invalid_unsigned_int)
@@ -9482,9 +9753,11 @@ XDMFEntry::XDMFEntry(const std::string   &mesh_filename,
                      const std::uint64_t  cells,
                      const unsigned int   dim,
                      const unsigned int   spacedim,
-                     const ReferenceCell &cell_type_)
+                     const ReferenceCell &cell_type_,
+                     const std::string   &solution_group)
   : valid(true)
   , h5_sol_filename(solution_filename)
+  , h5_sol_group(solution_group)
   , h5_mesh_filename(mesh_filename)
   , entry_time(time)
   , num_nodes(nodes)
@@ -9623,8 +9896,10 @@ XDMFEntry::get_xdmf_content(const unsigned int indent_level) const
       ss << indent(indent_level + 2) << "<DataItem Dimensions=\"" << num_nodes
          << " " << (attribute_dim.second > 1 ? 3 : 1)
          << "\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">\n";
-      ss << indent(indent_level + 3) << h5_sol_filename << ":/"
-         << attribute_dim.first << '\n';
+      ss << indent(indent_level + 3) << h5_sol_filename << ":/";
+      if (!h5_sol_group.empty())
+        ss << h5_sol_group << '/';
+      ss << attribute_dim.first << '\n';
       ss << indent(indent_level + 2) << "</DataItem>\n";
       ss << indent(indent_level + 1) << "</Attribute>\n";
     }
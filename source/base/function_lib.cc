@@ -18,6 +18,7 @@
 #include <deal.II/base/point.h>
 #include <deal.II/base/std_cxx17/cmath.h>
 #include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
 
 #include <deal.II/lac/vector.h>
 
@@ -36,6 +37,19 @@ namespace Functions
   }
 
 
+  template <int dim>
+  VectorizedArray<double>
+  SquareFunction<dim>::vectorized_value(
+    const Point<dim, VectorizedArray<double>> &p,
+    const unsigned int) const
+  {
+    VectorizedArray<double> result = p[0] * p[0];
+    for (unsigned int d = 1; d < dim; ++d)
+      result += p[d] * p[d];
+    return result;
+  }
+
+
   template <int dim>
   void
   SquareFunction<dim>::vector_value(const Point<dim> &p,
@@ -448,6 +462,18 @@ namespace Functions
     return 0.;
   }
 
+  template <int dim>
+  VectorizedArray<double>
+  CosineFunction<dim>::vectorized_value(
+    const Point<dim, VectorizedArray<double>> &p,
+    const unsigned int) const
+  {
+    VectorizedArray<double> result = std::cos(numbers::PI_2 * p[0]);
+    for (unsigned int d = 1; d < dim; ++d)
+      result *= std::cos(numbers::PI_2 * p[d]);
+    return result;
+  }
+
   template <int dim>
   void
   CosineFunction<dim>::value_list(const std::vector<Point<dim>> &points,
@@ -1031,6 +1057,18 @@ namespace Functions
     return 0.;
   }
 
+  template <int dim>
+  VectorizedArray<double>
+  ExpFunction<dim>::vectorized_value(
+    const Point<dim, VectorizedArray<double>> &p,
+    const unsigned int) const
+  {
+    VectorizedArray<double> result = std::exp(p[0]);
+    for (unsigned int d = 1; d < dim; ++d)
+      result *= std::exp(p[d]);
+    return result;
+  }
+
   template <int dim>
   void
   ExpFunction<dim>::value_list(const std::vector<Point<dim>> &points,
@@ -1947,6 +1985,21 @@ namespace Functions
 
 
 
+  template <int dim>
+  VectorizedArray<double>
+  FourierCosineFunction<dim>::vectorized_value(
+    const Point<dim, VectorizedArray<double>> &p,
+    const unsigned int                         component) const
+  {
+    AssertIndexRange(component, 1);
+    VectorizedArray<double> argument = fourier_coefficients[0] * p[0];
+    for (unsigned int d = 1; d < dim; ++d)
+      argument += fourier_coefficients[d] * p[d];
+    return std::cos(argument);
+  }
+
+
+
   template <int dim>
   Tensor<1, dim>
   FourierCosineFunction<dim>::gradient(const Point<dim>  &p,
@@ -1994,6 +2047,21 @@ namespace Functions
 
 
 
+  template <int dim>
+  VectorizedArray<double>
+  FourierSineFunction<dim>::vectorized_value(
+    const Point<dim, VectorizedArray<double>> &p,
+    const unsigned int                         component) const
+  {
+    AssertIndexRange(component, 1);
+    VectorizedArray<double> argument = fourier_coefficients[0] * p[0];
+    for (unsigned int d = 1; d < dim; ++d)
+      argument += fourier_coefficients[d] * p[d];
+    return std::sin(argument);
+  }
+
+
+
   template <int dim>
   Tensor<1, dim>
   FourierSineFunction<dim>::gradient(const Point<dim>  &p,
@@ -16,12 +16,20 @@
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
+#include <algorithm>
+#include <array>
+#include <cctype>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <ctime>
 #include <limits>
+#include <locale>
 #include <map>
 #include <mutex>
 #include <random>
+#include <sstream>
+#include <tuple>
 #include <vector>
 
 #ifdef DEAL_II_WITH_MUPARSER
@@ -256,6 +264,859 @@ namespace internal
 
 
 
+#ifdef DEAL_II_WITH_MUPARSER
+    namespace
+    {
+      using UnaryFunction  = double (*)(double);
+      using BinaryFunction = double (*)(double, double);
+
+      // The functions of compiled expressions that are applied to each lane
+      // of a VectorizedArray separately. We use the same implementations as
+      // muParser (and the definitions above) to get identical results.
+      const std::pair<const char *, UnaryFunction> unary_functions[] = {
+        {"sin", mu::MathImpl<double>::Sin},
+        {"cos", mu::MathImpl<double>::Cos},
+        {"tan", mu::MathImpl<double>::Tan},
+        {"asin", mu::MathImpl<double>::ASin},
+        {"acos", mu::MathImpl<double>::ACos},
+        {"atan", mu::MathImpl<double>::ATan},
+        {"sinh", mu::MathImpl<double>::Sinh},
+        {"cosh", mu::MathImpl<double>::Cosh},
+        {"tanh", mu::MathImpl<double>::Tanh},
+        {"asinh", mu::MathImpl<double>::ASinh},
+        {"acosh", mu::MathImpl<double>::ACosh},
+        {"atanh", mu::MathImpl<double>::ATanh},
+        {"log2", mu::MathImpl<double>::Log2},
+        {"log10", mu::MathImpl<double>::Log10},
+        {"ln", mu::MathImpl<double>::Log},
+        {"exp", mu::MathImpl<double>::Exp},
+        {"sign", mu::MathImpl<double>::Sign},
+        {"rint", mu::MathImpl<double>::Rint},
+        {"log", mu_log},
+        {"int", mu_int},
+        {"ceil", mu_ceil},
+        {"floor", mu_floor},
+        {"cot", mu_cot},
+        {"csc", mu_csc},
+        {"sec", mu_sec},
+        {"erfc", mu_erfc}};
+
+      const std::pair<const char *, BinaryFunction> binary_functions[] = {
+        {"atan2", mu::MathImpl<double>::ATan2},
+        {"pow", mu_pow},
+        // the operators '&' and '|' defined by deal.II
+        {"&", mu_and},
+        {"|", mu_or}};
+
+
+
+      // Return the index of the function with the given name in one of the
+      // tables above, or numbers::invalid_unsigned_int if there is none.
+      template <typename FunctionType, std::size_t n_functions>
+      unsigned int
+      find_function(
+        const std::pair<const char *, FunctionType> (&functions)[n_functions],
+        const std::string &name)
+      {
+        for (unsigned int i = 0; i < n_functions; ++i)
+          if (name == functions[i].first)
+            return i;
+        return numbers::invalid_unsigned_int;
+      }
+
+
+
+      inline double
+      apply_function(const UnaryFunction function, const double x)
+      {
+        return function(x);
+      }
+
+
+
+      inline VectorizedArray<double>
+      apply_function(const UnaryFunction            function,
+                     const VectorizedArray<double> &x)
+      {
+        VectorizedArray<double> result;
+        for (unsigned int v = 0; v < VectorizedArray<double>::size(); ++v)
+          result[v] = function(x[v]);
+        return result;
+      }
+
+
+
+      inline double
+      apply_function(const BinaryFunction function,
+                     const double         x,
+                     const double         y)
+      {
+        return function(x, y);
+      }
+
+
+
+      inline VectorizedArray<double>
+      apply_function(const BinaryFunction           function,
+                     const VectorizedArray<double> &x,
+                     const VectorizedArray<double> &y)
+      {
+        VectorizedArray<double> result;
+        for (unsigned int v = 0; v < VectorizedArray<double>::size(); ++v)
+          result[v] = function(x[v], y[v]);
+        return result;
+      }
+    } // namespace
+
+
+
+    /**
+     * A recursive descent parser for the part of the muParser syntax
+     * supported by CompiledExpressions. From the lowest to the highest
+     * precedence, the grammar consists of the ternary operator, the logical
+     * 'or' operators `||` and `|`, the logical 'and' operators `&&` and `&`,
+     * the comparison operators, addition and subtraction, multiplication and
+     * division, unary signs, and powers. As in muParser, `-x^2` means
+     * `-(x^2)`. Since muParser versions differ in the associativity of chained
+     * powers such as `x^y^z`, these are not supported.
+     *
+     * Each parsing function returns the index of the instruction that computes
+     * the value of the parsed subexpression. Instructions are only added if an
+     * identical one does not exist yet, and instructions with only constant
+     * arguments are replaced by their result.
+     */
+    class CompiledExpressions::Compiler
+    {
+    public:
+      /**
+       * The exception thrown for expressions that cannot be compiled.
+       */
+      struct Unsupported
+      {};
+
+      Compiler(CompiledExpressions                 &compiled_expressions,
+               const std::vector<std::string>      &variable_names,
+               const std::map<std::string, double> &constants)
+        : instructions(compiled_expressions.instructions)
+        , variable_names(variable_names)
+        , constants(constants)
+        , position(0)
+      {
+        // muParser also knows a few constants such as _pi, which we take
+        // from a parser object so that we use the exact same values
+        const mu::Parser parser;
+        for (const auto &constant : parser.GetConst())
+          predefined_constants.emplace(constant.first, constant.second);
+      }
+
+      /**
+       * Return the number of arguments of the given opcode.
+       */
+      static unsigned int
+      n_arguments(const Opcode opcode)
+      {
+        switch (opcode)
+          {
+            case Opcode::constant:
+            case Opcode::variable:
+              return 0;
+            case Opcode::negate:
+            case Opcode::square_root:
+            case Opcode::absolute_value:
+            case Opcode::unary_function:
+              return 1;
+            case Opcode::select:
+              return 3;
+            default:
+              return 2;
+          }
+      }
+
+      /**
+       * Translate the given expression and return the index of the
+       * instruction computing its value.
+       */
+      unsigned int
+      translate(const std::string &expression)
+      {
+        this->expression = expression;
+        position         = 0;
+
+        const unsigned int result = parse_ternary();
+        skip_whitespace();
+        if (position != expression.size())
+          throw Unsupported();
+        return result;
+      }
+
+    private:
+      unsigned int
+      parse_ternary()
+      {
+        const unsigned int condition = parse_or();
+        if (!accept("?"))
+          return condition;
+
+        const unsigned int if_true = parse_ternary();
+        expect(":");
+        const unsigned int if_false = parse_ternary();
+        return add_instruction(Opcode::select, condition, if_true, if_false);
+      }
+
+      unsigned int
+      parse_or()
+      {
+        unsigned int result = parse_and();
+        while (true)
+          if (accept("||"))
+            {
+              const unsigned int right = parse_and();
+              result                   = add_instruction(
+                Opcode::select,
+                result,
+                add_constant(1.),
+                add_instruction(Opcode::not_equal, right, add_constant(0.)));
+            }
+          else if (accept("|"))
+            result = add_instruction(Opcode::binary_function,
+                                     result,
+                                     parse_and(),
+                                     0,
+                                     find_function(binary_functions, "|"));
+          else
+            return result;
+      }
+
+      unsigned int
+      parse_and()
+      {
+        unsigned int result = parse_comparison();
+        while (true)
+          if (accept("&&"))
+            {
+              const unsigned int right = parse_comparison();
+              result                   = add_instruction(
+                Opcode::select,
+                result,
+                add_instruction(Opcode::not_equal, right, add_constant(0.)),
+                add_constant(0.));
+            }
+          else if (accept("&"))
+            result = add_instruction(Opcode::binary_function,
+                                     result,
+                                     parse_comparison(),
+                                     0,
+                                     find_function(binary_functions, "&"));
+          else
+            return result;
+      }
+
+      unsigned int
+      parse_comparison()
+      {
+        const std::pair<const char *, Opcode> operators[] = {
+          {"<=", Opcode::less_equal},
+          {">=", Opcode::greater_equal},
+          {"==", Opcode::equal},
+          {"!=", Opcode::not_equal},
+          {"<", Opcode::less},
+          {">", Opcode::greater}};
+
+        unsigned int result = parse_additive();
+        while (true)
+          {
+            bool found = false;
+            for (const auto &op : operators)
+              if (accept(op.first))
+                {
+                  result =
+                    add_instruction(op.second, result, parse_additive());
+                  found = true;
+                  break;
+                }
+            if (!found)
+              return result;
+          }
+      }
+
+      unsigned int
+      parse_additive()
+      {
+        unsigned int result = parse_multiplicative();
+        while (true)
+          if (accept("+"))
+            result =
+              add_instruction(Opcode::add, result, parse_multiplicative());
+          else if (accept("-"))
+            result =
+              add_instruction(Opcode::subtract, result, parse_multiplicative());
+          else
+            return result;
+      }
+
+      unsigned int
+      parse_multiplicative()
+      {
+        unsigned int result = parse_unary();
+        while (true)
+          if (accept("*"))
+            result = add_instruction(Opcode::multiply, result, parse_unary());
+          else if (accept("/"))
+            result = add_instruction(Opcode::divide, result, parse_unary());
+          else
+            return result;
+      }
+
+      unsigned int
+      parse_unary()
+      {
+        if (accept("-"))
+          return add_instruction(Opcode::negate, parse_unary());
+        else if (accept("+"))
+          return parse_unary();
+        else
+          return parse_power();
+      }
+
+      unsigned int
+      parse_power()
+      {
+        const unsigned int base = parse_primary();
+        if (!accept("^"))
+          return base;
+
+        const unsigned int exponent = parse_exponent();
+        if (accept("^"))
+          throw Unsupported();
+
+        // like the bytecode optimizer of muParser, compute the powers 2, 3,
+        // and 4 of a variable by repeated multiplications, and all other
+        // powers by std::pow()
+        if (instructions[base].opcode == Opcode::variable &&
+            instructions[exponent].opcode == Opcode::constant &&
+            (instructions[exponent].value == 2. ||
+             instructions[exponent].value == 3. ||
+             instructions[exponent].value == 4.))
+          {
+            unsigned int result = add_instruction(Opcode::multiply, base, base);
+            for (unsigned int i = 2; i < instructions[exponent].value; ++i)
+              result = add_instruction(Opcode::multiply, result, base);
+            return result;
+          }
+        else
+          return add_instruction(Opcode::binary_function,
+                                 base,
+                                 exponent,
+                                 0,
+                                 find_function(binary_functions, "pow"));
+      }
+
+      unsigned int
+      parse_exponent()
+      {
+        if (accept("-"))
+          return add_instruction(Opcode::negate, parse_exponent());
+        else if (accept("+"))
+          return parse_exponent();
+        else
+          return parse_primary();
+      }
+
+      unsigned int
+      parse_primary()
+      {
+        if (accept("("))
+          {
+            const unsigned int result = parse_ternary();
+            expect(")");
+            return result;
+          }
+
+        if (position < expression.size() &&
+            (std::isdigit(static_cast<unsigned char>(expression[position])) ||
+             expression[position] == '.'))
+          return parse_number();
+
+        const std::string name = parse_name();
+        if (accept("("))
+          return parse_function(name);
+
+        for (unsigned int i = 0; i < variable_names.size(); ++i)
+          if (name == variable_names[i])
+            return add_instruction(Opcode::variable, i);
+
+        const auto constant = constants.find(name);
+        if (constant != constants.end())
+          return add_constant(constant->second);
+
+        const auto predefined_constant = predefined_constants.find(name);
+        if (predefined_constant != predefined_constants.end())
+          return add_constant(predefined_constant->second);
+
+        throw Unsupported();
+      }
+
+      unsigned int
+      parse_number()
+      {
+        const auto is_digit = [&](const std::size_t i) {
+          return i < expression.size() &&
+                 std::isdigit(static_cast<unsigned char>(expression[i]));
+        };
+
+        const std::size_t start = position;
+        while (is_digit(position))
+          ++position;
+        if (position < expression.size() && expression[position] == '.')
+          ++position;
+        while (is_digit(position))
+          ++position;
+        if (position < expression.size() &&
+            (expression[position] == 'e' || expression[position] == 'E'))
+          {
+            std::size_t end = position + 1;
+            if (end < expression.size() &&
+                (expression[end] == '+' || expression[end] == '-'))
+              ++end;
+            if (is_digit(end))
+              {
+                position = end;
+                while (is_digit(position))
+                  ++position;
+              }
+          }
+
+        // convert in the same locale-independent way as muParser
+        std::istringstream stream(expression.substr(start, position - start));
+        stream.imbue(std::locale::classic());
+        double value = 0;
+        stream >> value;
+        if (stream.fail() || !stream.eof())
+          throw Unsupported();
+        return add_constant(value);
+      }
+
+      std::string
+      parse_name()
+      {
+        const std::size_t start = position;
+        while (position < expression.size() &&
+               (std::isalnum(
+                  static_cast<unsigned char>(expression[position])) ||
+                expression[position] == '_'))
+          ++position;
+        if (position == start)
+          throw Unsupported();
+        return expression.substr(start, position - start);
+      }
+
+      unsigned int
+      parse_function(const std::string &name)
+      {
+        std::vector<unsigned int> arguments(1, parse_ternary());
+        while (accept(","))
+          arguments.push_back(parse_ternary());
+        expect(")");
+
+        if (name == "if" && arguments.size() == 3)
+          return add_instruction(
+            Opcode::select,
+            add_instruction(Opcode::unary_function,
+                            arguments[0],
+                            0,
+                            0,
+                            find_function(unary_functions, "int")),
+            arguments[1],
+            arguments[2]);
+        else if (name == "min" || name == "max")
+          {
+            unsigned int result = arguments[0];
+            for (unsigned int i = 1; i < arguments.size(); ++i)
+              result = add_instruction(name == "min" ? Opcode::minimum :
+                                                       Opcode::maximum,
+                                       result,
+                                       arguments[i]);
+            return result;
+          }
+        else if (name == "sum" || name == "avg")
+          {
+            unsigned int result = arguments[0];
+            for (unsigned int i = 1; i < arguments.size(); ++i)
+              result = add_instruction(Opcode::add, result, arguments[i]);
+            if (name == "avg")
+              result = add_instruction(Opcode::divide,
+                                       result,
+                                       add_constant(arguments.size()));
+            return result;
+          }
+        else if (arguments.size() == 1)
+          {
+            if (name == "sqrt")
+              return add_instruction(Opcode::square_root, arguments[0]);
+            else if (name == "abs")
+              return add_instruction(Opcode::absolute_value, arguments[0]);
+
+            const unsigned int function = find_function(unary_functions, name);
+            if (function != numbers::invalid_unsigned_int)
+              return add_instruction(
+                Opcode::unary_function, arguments[0], 0, 0, function);
+          }
+        else if (arguments.size() == 2)
+          {
+            const unsigned int function =
+              find_function(binary_functions, name);
+            if (function != numbers::invalid_unsigned_int)
+              return add_instruction(Opcode::binary_function,
+                                     arguments[0],
+                                     arguments[1],
+                                     0,
+                                     function);
+          }
+
+        // erf, rand, rand_seed, and functions called with the wrong number
+        // of arguments are left to muParser
+        throw Unsupported();
+      }
+
+      void
+      skip_whitespace()
+      {
+        while (position < expression.size() &&
+               std::isspace(static_cast<unsigned char>(expression[position])))
+          ++position;
+      }
+
+      /**
+       * Skip whitespace and the given token if the expression continues with
+       * it, and return whether this was the case.
+       */
+      bool
+      accept(const char *token)
+      {
+        skip_whitespace();
+        const std::size_t length = std::strlen(token);
+        if (expression.compare(position, length, token) != 0)
+          return false;
+        position += length;
+        return true;
+      }
+
+      void
+      expect(const char *token)
+      {
+        if (!accept(token))
+          throw Unsupported();
+      }
+
+      unsigned int
+      add_constant(const double value)
+      {
+        Instruction instruction = {Opcode::constant, {0, 0, 0}, 0, value};
+        return insert(instruction);
+      }
+
+      unsigned int
+      add_instruction(const Opcode       opcode,
+                      const unsigned int argument_0 = 0,
+                      const unsigned int argument_1 = 0,
+                      const unsigned int argument_2 = 0,
+                      const unsigned int function   = 0)
+      {
+        AssertIndexRange(function, numbers::invalid_unsigned_int);
+        Instruction instruction = {
+          opcode, {argument_0, argument_1, argument_2}, function, 0.};
+
+        // evaluate instructions that only depend on constants right away
+        if (opcode != Opcode::variable)
+          {
+            bool only_constant_arguments = true;
+            for (unsigned int i = 0; i < n_arguments(opcode); ++i)
+              if (instructions[instruction.arguments[i]].opcode !=
+                  Opcode::constant)
+                only_constant_arguments = false;
+            if (only_constant_arguments)
+              return add_constant(
+                compute<double>(instruction, nullptr, constant_values.data()));
+          }
+
+        // sort the arguments of commutative operations to find more common
+        // subexpressions
+        if (opcode == Opcode::add || opcode == Opcode::multiply ||
+            opcode == Opcode::equal || opcode == Opcode::not_equal)
+          if (instruction.arguments[0] > instruction.arguments[1])
+            std::swap(instruction.arguments[0], instruction.arguments[1]);
+
+        return insert(instruction);
+      }
+
+      /**
+       * Append the given instruction unless an identical one exists already,
+       * and return its index.
+       */
+      unsigned int
+      insert(const Instruction &instruction)
+      {
+        // compare constants by their bit pattern: this keeps -0 and +0
+        // apart, and folded constants may be NaN, which does not compare
+        // equal to itself and would break the ordering of the map
+        static_assert(sizeof(double) == sizeof(std::uint64_t),
+                      "The bit pattern of a double must fit into 64 bits.");
+        std::uint64_t value_bits;
+        std::memcpy(&value_bits, &instruction.value, sizeof(double));
+
+        const auto key = std::make_tuple(instruction.opcode,
+                                         instruction.arguments[0],
+                                         instruction.arguments[1],
+                                         instruction.arguments[2],
+                                         instruction.function,
+                                         value_bits);
+        const auto [entry, inserted] =
+          known_instructions.emplace(key, instructions.size());
+        if (inserted)
+          {
+            instructions.push_back(instruction);
+            constant_values.push_back(instruction.value);
+          }
+        return entry->second;
+      }
+
+      std::vector<Instruction> &instructions;
+
+      const std::vector<std::string> &variable_names;
+
+      const std::map<std::string, double> &constants;
+
+      std::map<std::string, double> predefined_constants;
+
+      /**
+       * The values of all instructions with opcode `constant`, used as
+       * registers when evaluating instructions at compile time.
+       */
+      std::vector<double> constant_values;
+
+      /**
+       * All instructions added so far.
+       */
+      std::map<std::tuple<Opcode,
+                          unsigned int,
+                          unsigned int,
+                          unsigned int,
+                          unsigned int,
+                          std::uint64_t>,
+               unsigned int>
+        known_instructions;
+
+      std::string expression;
+
+      std::size_t position;
+    };
+
+
+
+    bool
+    CompiledExpressions::compile(
+      const std::vector<std::string>      &expressions,
+      const std::vector<std::string>      &variable_names,
+      const std::map<std::string, double> &constants)
+    {
+      instructions.clear();
+      outputs.clear();
+      component_instructions.clear();
+      all_instructions.clear();
+
+      try
+        {
+          Compiler compiler(*this, variable_names, constants);
+          for (const std::string &expression : expressions)
+            outputs.push_back(compiler.translate(expression));
+        }
+      catch (const Compiler::Unsupported &)
+        {
+          instructions.clear();
+          outputs.clear();
+          return false;
+        }
+
+      // collect the instructions each component depends on by walking
+      // backwards from the instruction computing its result
+      std::vector<bool> needed_by_any(instructions.size(), false);
+      component_instructions.resize(outputs.size());
+      for (unsigned int c = 0; c < outputs.size(); ++c)
+        {
+          std::vector<bool> needed(instructions.size(), false);
+          needed[outputs[c]] = true;
+          for (unsigned int i = outputs[c] + 1; i-- > 0;)
+            if (needed[i])
+              {
+                needed_by_any[i] = true;
+                component_instructions[c].push_back(i);
+                for (unsigned int a = 0;
+                     a < Compiler::n_arguments(instructions[i].opcode);
+                     ++a)
+                  needed[instructions[i].arguments[a]] = true;
+              }
+          std::reverse(component_instructions[c].begin(),
+                       component_instructions[c].end());
+        }
+      for (unsigned int i = 0; i < instructions.size(); ++i)
+        if (needed_by_any[i])
+          all_instructions.push_back(i);
+
+      return true;
+    }
+
+
+
+    template <typename Number>
+    inline Number
+    CompiledExpressions::compute(const Instruction &instruction,
+                                 const Number      *variables,
+                                 const Number      *registers)
+    {
+      const unsigned int *const arguments = instruction.arguments;
+      switch (instruction.opcode)
+        {
+          case Opcode::constant:
+            return Number(instruction.value);
+          case Opcode::variable:
+            return variables[arguments[0]];
+          case Opcode::add:
+            return registers[arguments[0]] + registers[arguments[1]];
+          case Opcode::subtract:
+            return registers[arguments[0]] - registers[arguments[1]];
+          case Opcode::multiply:
+            return registers[arguments[0]] * registers[arguments[1]];
+          case Opcode::divide:
+            return registers[arguments[0]] / registers[arguments[1]];
+          case Opcode::negate:
+            return -registers[arguments[0]];
+          case Opcode::less:
+            return compare_and_apply_mask<SIMDComparison::less_than>(
+              registers[arguments[0]],
+              registers[arguments[1]],
+              Number(1.),
+              Number(0.));
+          case Opcode::greater:
+            return compare_and_apply_mask<SIMDComparison::greater_than>(
+              registers[arguments[0]],
+              registers[arguments[1]],
+              Number(1.),
+              Number(0.));
+          case Opcode::less_equal:
+            return compare_and_apply_mask<SIMDComparison::less_than_or_equal>(
+              registers[arguments[0]],
+              registers[arguments[1]],
+              Number(1.),
+              Number(0.));
+          case Opcode::greater_equal:
+            return compare_and_apply_mask<
+              SIMDComparison::greater_than_or_equal>(registers[arguments[0]],
+                                                     registers[arguments[1]],
+                                                     Number(1.),
+                                                     Number(0.));
+          case Opcode::equal:
+            return compare_and_apply_mask<SIMDComparison::equal>(
+              registers[arguments[0]],
+              registers[arguments[1]],
+              Number(1.),
+              Number(0.));
+          case Opcode::not_equal:
+            return compare_and_apply_mask<SIMDComparison::not_equal>(
+              registers[arguments[0]],
+              registers[arguments[1]],
+              Number(1.),
+              Number(0.));
+          case Opcode::select:
+            return compare_and_apply_mask<SIMDComparison::equal>(
+              registers[arguments[0]],
+              Number(0.),
+              registers[arguments[2]],
+              registers[arguments[1]]);
+          case Opcode::minimum:
+            return std::min(registers[arguments[0]], registers[arguments[1]]);
+          case Opcode::maximum:
+            return std::max(registers[arguments[0]], registers[arguments[1]]);
+          case Opcode::square_root:
+            return std::sqrt(registers[arguments[0]]);
+          case Opcode::absolute_value:
+            return std::abs(registers[arguments[0]]);
+          case Opcode::unary_function:
+            return apply_function(unary_functions[instruction.function].second,
+                                  registers[arguments[0]]);
+          case Opcode::binary_function:
+            return apply_function(
+              binary_functions[instruction.function].second,
+              registers[arguments[0]],
+              registers[arguments[1]]);
+        }
+      DEAL_II_ASSERT_UNREACHABLE();
+      return Number();
+    }
+
+
+
+    template <typename Number>
+    Number
+    CompiledExpressions::evaluate(const Number      *variables,
+                                  const unsigned int component,
+                                  Number            *registers) const
+    {
+      AssertIndexRange(component, outputs.size());
+      for (const unsigned int i : component_instructions[component])
+        registers[i] = compute(instructions[i], variables, registers);
+      return registers[outputs[component]];
+    }
+
+
+
+    template <typename Number>
+    void
+    CompiledExpressions::evaluate_all(const Number *variables,
+                                      Number       *registers) const
+    {
+      for (const unsigned int i : all_instructions)
+        registers[i] = compute(instructions[i], variables, registers);
+    }
+
+#else
+
+    bool
+    CompiledExpressions::compile(const std::vector<std::string> &,
+                                 const std::vector<std::string> &,
+                                 const std::map<std::string, double> &)
+    {
+      return false;
+    }
+
+#endif
+
+
+
+    bool
+    CompiledExpressions::empty() const
+    {
+      return outputs.empty();
+    }
+
+
+
+    unsigned int
+    CompiledExpressions::n_registers() const
+    {
+      return instructions.size();
+    }
+
+
+
+    unsigned int
+    CompiledExpressions::output_register(const unsigned int component) const
+    {
+      AssertIndexRange(component, outputs.size());
+      return outputs[component];
+    }
+
+
+
     template <int dim, typename Number>
     ParserImplementation<dim, Number>::ParserImplementation()
       : initialized(false)
@@ -296,6 +1157,13 @@ namespace internal
       // user may never call these functions on the current thread, but it gets
       // us error messages about wrong formulas right away
       this->init_muparser();
+
+      // in addition, try to translate the expressions into a form that can be
+      // evaluated for several points at once. expressions that cannot be
+      // translated are evaluated by muParser
+      this->compiled_expressions.compile(this->expressions,
+                                         this->var_names,
+                                         this->constants);
       this->initialized = true;
     }
 
@@ -415,6 +1283,29 @@ namespace internal
 #ifdef DEAL_II_WITH_MUPARSER
       Assert(this->initialized == true, ExcNotInitialized());
 
+      if (!this->compiled_expressions.empty())
+        {
+          std::array<double, dim + 1> variables;
+          for (unsigned int i = 0; i < dim; ++i)
+            variables[i] = p[i];
+          variables[dim] = time;
+
+          // avoid the lookup of thread-local data for short expressions
+          const unsigned int n_registers =
+            this->compiled_expressions.n_registers();
+          std::array<double, 64> local_registers;
+          if (n_registers <= local_registers.size())
+            return this->compiled_expressions.evaluate(variables.data(),
+                                                       component,
+                                                       local_registers.data());
+
+          ParserData &data = this->parser_data.get();
+          data.registers.resize(n_registers);
+          return this->compiled_expressions.evaluate(variables.data(),
+                                                     component,
+                                                     data.registers.data());
+        }
+
       // initialize the parser if that hasn't happened yet on the current
       // thread
       internal::FunctionParser::ParserData &data = this->parser_data.get();
@@ -463,9 +1354,28 @@ namespace internal
 #ifdef DEAL_II_WITH_MUPARSER
       Assert(this->initialized == true, ExcNotInitialized());
 
+      internal::FunctionParser::ParserData &data = this->parser_data.get();
+
+      if (!this->compiled_expressions.empty())
+        {
+          AssertDimension(values.size(), this->expressions.size());
+          std::array<double, dim + 1> variables;
+          for (unsigned int i = 0; i < dim; ++i)
+            variables[i] = p[i];
+          variables[dim] = time;
+
+          data.registers.resize(this->compiled_expressions.n_registers());
+          this->compiled_expressions.evaluate_all(variables.data(),
+                                                  data.registers.data());
+          for (unsigned int component = 0; component < values.size();
+               ++component)
+            values[component] = data.registers[this->compiled_expressions
+                                                 .output_register(component)];
+          return;
+        }
+
       // initialize the parser if that hasn't happened yet on the current
       // thread
-      internal::FunctionParser::ParserData &data = this->parser_data.get();
       if (data.vars.empty())
         init_muparser();
 
@@ -506,6 +1416,150 @@ namespace internal
 #endif
     }
 
+
+
+
+    template <int dim, typename Number>
+    void
+    ParserImplementation<dim, Number>::do_value_list(
+      const ArrayView<const Point<dim>> &points,
+      const double                       time,
+      const unsigned int                 component,
+      const ArrayView<Number>           &values) const
+    {
+      AssertDimension(points.size(), values.size());
+      Assert(this->initialized == true, ExcNotInitialized());
+
+#ifdef DEAL_II_WITH_MUPARSER
+      if (!this->compiled_expressions.empty())
+        {
+          constexpr unsigned int n_lanes = VectorizedArray<double>::size();
+
+          ParserData &data = this->parser_data.get();
+          data.vectorized_registers.resize(
+            this->compiled_expressions.n_registers());
+
+          std::array<VectorizedArray<double>, dim + 1> variables;
+          variables[dim] = time;
+          for (unsigned int q = 0; q < points.size(); q += n_lanes)
+            {
+              // fill unused lanes of the last batch with the last point to
+              // not evaluate the expressions at arbitrary values
+              const unsigned int n_filled =
+                std::min<std::size_t>(n_lanes, points.size() - q);
+              for (unsigned int v = 0; v < n_lanes; ++v)
+                for (unsigned int d = 0; d < dim; ++d)
+                  variables[d][v] = points[q + std::min(v, n_filled - 1)][d];
+
+              const VectorizedArray<double> result =
+                this->compiled_expressions.evaluate(
+                  variables.data(),
+                  component,
+                  data.vectorized_registers.data());
+              for (unsigned int v = 0; v < n_filled; ++v)
+                values[q + v] = result[v];
+            }
+          return;
+        }
+#endif
+
+      for (unsigned int q = 0; q < points.size(); ++q)
+        values[q] = this->do_value(points[q], time, component);
+    }
+
+
+
+    template <int dim, typename Number>
+    void
+    ParserImplementation<dim, Number>::do_all_values_list(
+      const ArrayView<const Point<dim>> &points,
+      const double                       time,
+      const ArrayView<Number>           &values) const
+    {
+      const unsigned int n_components = this->expressions.size();
+      AssertDimension(points.size() * n_components, values.size());
+      Assert(this->initialized == true, ExcNotInitialized());
+
+#ifdef DEAL_II_WITH_MUPARSER
+      if (!this->compiled_expressions.empty())
+        {
+          constexpr unsigned int n_lanes = VectorizedArray<double>::size();
+
+          ParserData &data = this->parser_data.get();
+          data.vectorized_registers.resize(
+            this->compiled_expressions.n_registers());
+
+          std::array<VectorizedArray<double>, dim + 1> variables;
+          variables[dim] = time;
+          for (unsigned int q = 0; q < points.size(); q += n_lanes)
+            {
+              const unsigned int n_filled =
+                std::min<std::size_t>(n_lanes, points.size() - q);
+              for (unsigned int v = 0; v < n_lanes; ++v)
+                for (unsigned int d = 0; d < dim; ++d)
+                  variables[d][v] = points[q + std::min(v, n_filled - 1)][d];
+
+              this->compiled_expressions.evaluate_all(
+                variables.data(), data.vectorized_registers.data());
+              for (unsigned int c = 0; c < n_components; ++c)
+                {
+                  const VectorizedArray<double> &result =
+                    data.vectorized_registers
+                      [this->compiled_expressions.output_register(c)];
+                  for (unsigned int v = 0; v < n_filled; ++v)
+                    values[(q + v) * n_components + c] = result[v];
+                }
+            }
+          return;
+        }
+#endif
+
+      for (unsigned int q = 0; q < points.size(); ++q)
+        {
+          ArrayView<Number> point_values(values.data() + q * n_components,
+                                         n_components);
+          this->do_all_values(points[q], time, point_values);
+        }
+    }
+
+
+
+    template <int dim, typename Number>
+    VectorizedArray<double>
+    ParserImplementation<dim, Number>::do_vectorized_value(
+      const Point<dim, VectorizedArray<double>> &p,
+      const double                               time,
+      const unsigned int                         component) const
+    {
+      Assert(this->initialized == true, ExcNotInitialized());
+
+#ifdef DEAL_II_WITH_MUPARSER
+      if (!this->compiled_expressions.empty())
+        {
+          ParserData &data = this->parser_data.get();
+          data.vectorized_registers.resize(
+            this->compiled_expressions.n_registers());
+
+          std::array<VectorizedArray<double>, dim + 1> variables;
+          for (unsigned int d = 0; d < dim; ++d)
+            variables[d] = p[d];
+          variables[dim] = time;
+          return this->compiled_expressions.evaluate(
+            variables.data(), component, data.vectorized_registers.data());
+        }
+#endif
+
+      VectorizedArray<double> result;
+      for (unsigned int v = 0; v < VectorizedArray<double>::size(); ++v)
+        {
+          Point<dim> point;
+          for (unsigned int d = 0; d < dim; ++d)
+            point[d] = p[d][v];
+          result[v] = std::real(this->do_value(point, time, component));
+        }
+      return result;
+    }
+
 // explicit instantiations
 #include "base/mu_parser_internal.inst"
 
@@ -15,6 +15,7 @@
 
 #include <deal.II/base/logstream.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/parameter_handler.h>
 #include <deal.II/base/utilities.h>
 
@@ -586,23 +587,71 @@ ParameterHandler::parse_input(const std::string &filename,
   std::ifstream is(filename);
   AssertThrow(is, ExcFileNotOpen(filename));
 
+  parse_input_by_extension(is, filename, last_line, skip_undefined);
+
+  if (assert_mandatory_entries_are_found)
+    assert_that_entries_have_been_set();
+}
+
+
+
+void
+ParameterHandler::parse_input(const std::string &filename,
+                              const MPI_Comm     mpi_communicator,
+                              const std::string &last_line,
+                              const bool         skip_undefined,
+                              const bool assert_mandatory_entries_are_found)
+{
+  // only let the root process touch the file system, and tell all other
+  // processes whether it succeeded so that all of them throw the same
+  // exception if the file does not exist
+  std::string content;
+  bool        file_is_open = true;
+  if (Utilities::MPI::this_mpi_process(mpi_communicator) == 0)
+    {
+      std::ifstream is(filename);
+      file_is_open = static_cast<bool>(is);
+      if (file_is_open)
+        {
+          std::ostringstream buffer;
+          buffer << is.rdbuf();
+          content = buffer.str();
+        }
+    }
+
+  file_is_open = Utilities::MPI::broadcast(mpi_communicator, file_is_open);
+  AssertThrow(file_is_open, ExcFileNotOpen(filename));
+  content = Utilities::MPI::broadcast(mpi_communicator, content);
+
+  std::istringstream is(content);
+  parse_input_by_extension(is, filename, last_line, skip_undefined);
+
+  if (assert_mandatory_entries_are_found)
+    assert_that_entries_have_been_set();
+}
+
+
+
+void
+ParameterHandler::parse_input_by_extension(std::istream      &input,
+                                           const std::string &filename,
+                                           const std::string &last_line,
+                                           const bool         skip_undefined)
+{
   std::string file_ending = filename.substr(filename.find_last_of('.') + 1);
   boost::algorithm::to_lower(file_ending);
   if (file_ending == "prm")
-    parse_input(is, filename, last_line, skip_undefined);
+    parse_input(input, filename, last_line, skip_undefined);
   else if (file_ending == "xml")
-    parse_input_from_xml(is, skip_undefined);
+    parse_input_from_xml(input, skip_undefined);
   else if (file_ending == "json")
-    parse_input_from_json(is, skip_undefined);
+    parse_input_from_json(input, skip_undefined);
   else
     AssertThrow(false,
                 ExcMessage("The given input file <" + filename +
                            "> has a file name extension <" + file_ending +
                            "> that is not recognized. Supported types "
                            "are .prm, .xml, and .json."));
-
-  if (assert_mandatory_entries_are_found)
-    assert_that_entries_have_been_set();
 }
 
 
@@ -880,6 +929,9 @@ ParameterHandler::clear()
 {
   entries = std::make_unique<boost::property_tree::ptree>();
   entries_set_status.clear();
+
+  std::lock_guard<std::mutex> lock(converted_values_mutex);
+  converted_values.clear();
 }
 
 
@@ -891,6 +943,10 @@ ParameterHandler::declare_entry(const std::string           &entry,
                                 const std::string           &documentation,
                                 const bool                   has_to_be_set)
 {
+  {
+    std::lock_guard<std::mutex> lock(converted_values_mutex);
+    converted_values.erase(get_current_full_path(entry));
+  }
   entries->put(get_current_full_path(entry) + path_separator + "value",
                default_value);
   entries->put(get_current_full_path(entry) + path_separator + "default_value",
@@ -1155,21 +1211,47 @@ ParameterHandler::get(const std::vector<std::string> &entry_subsection_path,
 
 
 
+template <typename T, typename Converter>
+T
+ParameterHandler::get_converted_value(const std::string &full_path,
+                                      const Converter   &convert) const
+{
+  {
+    std::lock_guard<std::mutex> lock(converted_values_mutex);
+    const auto it = converted_values.find(full_path);
+    if (it != converted_values.end())
+      if (const T *value = std::get_if<T>(&it->second))
+        return *value;
+  }
+
+  // convert outside the lock since the conversion may throw an exception
+  const T value = convert();
+
+  std::lock_guard<std::mutex> lock(converted_values_mutex);
+  converted_values[full_path] = value;
+  return value;
+}
+
+
+
 long int
 ParameterHandler::get_integer(const std::string &entry_string) const
 {
-  try
-    {
-      return Utilities::string_to_int(get(entry_string));
-    }
-  catch (...)
-    {
-      AssertThrow(false,
-                  ExcMessage("Can't convert the parameter value <" +
-                             get(entry_string) + "> for entry <" +
-                             entry_string + "> to an integer."));
-      return 0;
-    }
+  return get_converted_value<long int>(
+    get_current_full_path(entry_string), [&]() -> long int {
+      try
+        {
+          return Utilities::string_to_int(get(entry_string));
+        }
+      catch (...)
+        {
+          AssertThrow(false,
+                      ExcMessage("Can't convert the parameter value <" +
+                                 get(entry_string) + "> for entry <" +
+                                 entry_string + "> to an integer."));
+          return 0;
+        }
+    });
 }
 
 
@@ -1179,21 +1261,27 @@ ParameterHandler::get_integer(
   const std::vector<std::string> &entry_subsection_path,
   const std::string              &entry_string) const
 {
-  try
-    {
-      return Utilities::string_to_int(get(entry_subsection_path, entry_string));
-    }
-  catch (...)
-    {
-      AssertThrow(false,
-                  ExcMessage(
-                    "Can't convert the parameter value <" +
-                    get(entry_subsection_path, entry_string) + "> for entry <" +
-                    demangle(get_current_full_path(entry_subsection_path,
-                                                   entry_string)) +
-                    "> to an integer."));
-      return 0;
-    }
+  return get_converted_value<long int>(
+    get_current_full_path(entry_subsection_path, entry_string),
+    [&]() -> long int {
+      try
+        {
+          return Utilities::string_to_int(
+            get(entry_subsection_path, entry_string));
+        }
+      catch (...)
+        {
+          AssertThrow(false,
+                      ExcMessage(
+                        "Can't convert the parameter value <" +
+                        get(entry_subsection_path, entry_string) +
+                        "> for entry <" +
+                        demangle(get_current_full_path(entry_subsection_path,
+                                                       entry_string)) +
+                        "> to an integer."));
+          return 0;
+        }
+    });
 }
 
 
@@ -1201,19 +1289,22 @@ ParameterHandler::get_integer(
 double
 ParameterHandler::get_double(const std::string &entry_string) const
 {
-  try
-    {
-      return Utilities::string_to_double(get(entry_string));
-    }
-  catch (...)
-    {
-      AssertThrow(false,
-                  ExcMessage("Can't convert the parameter value <" +
-                             get(entry_string) + "> for entry <" +
-                             entry_string +
-                             "> to a double precision variable."));
-      return 0;
-    }
+  return get_converted_value<double>(
+    get_current_full_path(entry_string), [&]() -> double {
+      try
+        {
+          return Utilities::string_to_double(get(entry_string));
+        }
+      catch (...)
+        {
+          AssertThrow(false,
+                      ExcMessage("Can't convert the parameter value <" +
+                                 get(entry_string) + "> for entry <" +
+                                 entry_string +
+                                 "> to a double precision variable."));
+          return 0;
+        }
+    });
 }
 
 
@@ -1223,22 +1314,27 @@ ParameterHandler::get_double(
   const std::vector<std::string> &entry_subsection_path,
   const std::string              &entry_string) const
 {
-  try
-    {
-      return Utilities::string_to_double(
-        get(entry_subsection_path, entry_string));
-    }
-  catch (...)
-    {
-      AssertThrow(false,
-                  ExcMessage(
-                    "Can't convert the parameter value <" +
-                    get(entry_subsection_path, entry_string) + "> for entry <" +
-                    demangle(get_current_full_path(entry_subsection_path,
-                                                   entry_string)) +
-                    "> to a double precision variable."));
-      return 0;
-    }
+  return get_converted_value<double>(
+    get_current_full_path(entry_subsection_path, entry_string),
+    [&]() -> double {
+      try
+        {
+          return Utilities::string_to_double(
+            get(entry_subsection_path, entry_string));
+        }
+      catch (...)
+        {
+          AssertThrow(false,
+                      ExcMessage(
+                        "Can't convert the parameter value <" +
+                        get(entry_subsection_path, entry_string) +
+                        "> for entry <" +
+                        demangle(get_current_full_path(entry_subsection_path,
+                                                       entry_string)) +
+                        "> to a double precision variable."));
+          return 0;
+        }
+    });
 }
 
 
@@ -1246,16 +1342,20 @@ ParameterHandler::get_double(
 bool
 ParameterHandler::get_bool(const std::string &entry_string) const
 {
-  const std::string s = get(entry_string);
-
-  AssertThrow((s == "true") || (s == "false") || (s == "yes") || (s == "no"),
-              ExcMessage("Can't convert the parameter value <" +
-                         get(entry_string) + "> for entry <" + entry_string +
-                         "> to a boolean."));
-  if (s == "true" || s == "yes")
-    return true;
-  else
-    return false;
+  return get_converted_value<bool>(
+    get_current_full_path(entry_string), [&]() -> bool {
+      const std::string s = get(entry_string);
+
+      AssertThrow((s == "true") || (s == "false") || (s == "yes") ||
+                    (s == "no"),
+                  ExcMessage("Can't convert the parameter value <" +
+                             get(entry_string) + "> for entry <" +
+                             entry_string + "> to a boolean."));
+      if (s == "true" || s == "yes")
+        return true;
+      else
+        return false;
+    });
 }
 
 
@@ -1265,19 +1365,24 @@ ParameterHandler::get_bool(
   const std::vector<std::string> &entry_subsection_path,
   const std::string              &entry_string) const
 {
-  const std::string s = get(entry_subsection_path, entry_string);
-
-  AssertThrow((s == "true") || (s == "false") || (s == "yes") || (s == "no"),
-              ExcMessage("Can't convert the parameter value <" +
-                         get(entry_subsection_path, entry_string) +
-                         "> for entry <" +
-                         demangle(get_current_full_path(entry_subsection_path,
-                                                        entry_string)) +
-                         "> to a boolean."));
-  if (s == "true" || s == "yes")
-    return true;
-  else
-    return false;
+  return get_converted_value<bool>(
+    get_current_full_path(entry_subsection_path, entry_string),
+    [&]() -> bool {
+      const std::string s = get(entry_subsection_path, entry_string);
+
+      AssertThrow((s == "true") || (s == "false") || (s == "yes") ||
+                    (s == "no"),
+                  ExcMessage("Can't convert the parameter value <" +
+                             get(entry_subsection_path, entry_string) +
+                             "> for entry <" +
+                             demangle(get_current_full_path(
+                               entry_subsection_path, entry_string)) +
+                             "> to a boolean."));
+      if (s == "true" || s == "yes")
+        return true;
+      else
+        return false;
+    });
 }
 
 
@@ -1321,6 +1426,10 @@ ParameterHandler::set(const std::string &entry_string,
 
       // finally write the new value into the database
       entries->put(path + path_separator + "value", new_value);
+      {
+        std::lock_guard<std::mutex> lock(converted_values_mutex);
+        converted_values.erase(path);
+      }
 
       auto map_iter = entries_set_status.find(path);
       if (map_iter != entries_set_status.end())
@@ -2116,6 +2225,10 @@ ParameterHandler::scan_line(std::string        line,
 
           // finally write the new value into the database
           entries->put(path + path_separator + "value", entry_value);
+          {
+            std::lock_guard<std::mutex> lock(converted_values_mutex);
+            converted_values.erase(path);
+          }
 
           // record that the entry has been set manually
           auto map_iter = entries_set_status.find(path);
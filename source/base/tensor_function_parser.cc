@@ -124,10 +124,14 @@ TensorFunctionParser<rank, dim, Number>::value_list(
   Assert(p.size() == values.size(),
          ExcDimensionMismatch(p.size(), values.size()));
 
+  std::vector<Number> all_values(p.size() * n_components);
+  this->do_all_values_list(make_array_view(p),
+                           this->get_time(),
+                           make_array_view(all_values));
   for (unsigned int i = 0; i < p.size(); ++i)
-    {
-      values[i] = value(p[i]);
-    }
+    values[i] = Tensor<rank, dim, Number>(
+      make_array_view(all_values.begin() + i * n_components,
+                      all_values.begin() + (i + 1) * n_components));
 }
 
 // explicit instantiations
@@ -19,6 +19,10 @@
 #include <deal.II/base/utilities.h>
 
 #include <boost/io/ios_state.hpp>
+#include <boost/serialization/map.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
 
 #include <algorithm>
 #include <chrono>
@@ -27,7 +31,9 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #ifdef DEAL_II_HAVE_SYS_RESOURCE_H
 #  include <sys/resource.h>
@@ -301,6 +307,8 @@ TimerOutput::TimerOutput(std::ostream         &stream,
                          const OutputType      output_type)
   : output_frequency(output_frequency)
   , output_type(output_type)
+  , trace_is_enabled(false)
+  , reference_time(std::chrono::steady_clock::now())
   , out_stream(stream, true)
   , output_is_enabled(true)
   , mpi_communicator(MPI_COMM_SELF)
@@ -313,6 +321,8 @@ TimerOutput::TimerOutput(ConditionalOStream   &stream,
                          const OutputType      output_type)
   : output_frequency(output_frequency)
   , output_type(output_type)
+  , trace_is_enabled(false)
+  , reference_time(std::chrono::steady_clock::now())
   , out_stream(stream)
   , output_is_enabled(true)
   , mpi_communicator(MPI_COMM_SELF)
@@ -326,6 +336,8 @@ TimerOutput::TimerOutput(const MPI_Comm        mpi_communicator,
                          const OutputType      output_type)
   : output_frequency(output_frequency)
   , output_type(output_type)
+  , trace_is_enabled(false)
+  , reference_time(std::chrono::steady_clock::now())
   , out_stream(stream, true)
   , output_is_enabled(true)
   , mpi_communicator(mpi_communicator)
@@ -339,6 +351,8 @@ TimerOutput::TimerOutput(const MPI_Comm        mpi_communicator,
                          const OutputType      output_type)
   : output_frequency(output_frequency)
   , output_type(output_type)
+  , trace_is_enabled(false)
+  , reference_time(std::chrono::steady_clock::now())
   , out_stream(stream)
   , output_is_enabled(true)
   , mpi_communicator(mpi_communicator)
@@ -430,6 +444,33 @@ TimerOutput::enter_subsection(const std::string &section_name)
   ++sections[section_name].n_calls;
 
   active_sections.push_back(section_name);
+
+  // record the section as a child of the innermost section active on this
+  // thread, creating a new node of the tree if the section has not been
+  // entered from there before
+  const auto thread_entry =
+    thread_data.emplace(std::this_thread::get_id(), ThreadData());
+  ThreadData &data = thread_entry.first->second;
+  if (thread_entry.second)
+    {
+      data.index = thread_data.size() - 1;
+      data.nested_sections.emplace_back();
+    }
+
+  const unsigned int parent =
+    data.active_scopes.empty() ? 0 : data.active_scopes.back().nested_section;
+  const auto child = data.nested_sections[parent].children.emplace(
+    section_name, data.nested_sections.size());
+  if (child.second)
+    {
+      data.nested_sections.emplace_back();
+      data.nested_sections.back().name   = section_name;
+      data.nested_sections.back().parent = parent;
+    }
+
+  data.active_scopes.push_back(ActiveScope{section_name,
+                                           child.first->second,
+                                           std::chrono::steady_clock::now()});
 }
 
 
@@ -494,6 +535,46 @@ TimerOutput::leave_subsection(const std::string &section_name)
   active_sections.erase(std::find(active_sections.begin(),
                                   active_sections.end(),
                                   actual_section_name));
+
+  // Find the thread that entered the section. This is usually the current
+  // thread, but sections might also be left from another thread.
+  const auto find_scope = [&](ThreadData &data) {
+    return std::find_if(data.active_scopes.rbegin(),
+                        data.active_scopes.rend(),
+                        [&](const ActiveScope &scope) {
+                          return scope.name == actual_section_name;
+                        });
+  };
+  auto thread_entry = thread_data.find(std::this_thread::get_id());
+  if (thread_entry == thread_data.end() ||
+      find_scope(thread_entry->second) ==
+        thread_entry->second.active_scopes.rend())
+    thread_entry =
+      std::find_if(thread_data.begin(), thread_data.end(), [&](auto &entry) {
+        return find_scope(entry.second) != entry.second.active_scopes.rend();
+      });
+  Assert(thread_entry != thread_data.end(), ExcInternalError());
+
+  ThreadData &data  = thread_entry->second;
+  const auto  scope = std::prev(find_scope(data).base());
+
+  const auto end_time = std::chrono::steady_clock::now();
+  const double wall_time =
+    internal::TimerImplementation::to_seconds(end_time - scope->start_time);
+
+  NestedSection &nested_section = data.nested_sections[scope->nested_section];
+  nested_section.total_wall_time += wall_time;
+  ++nested_section.n_calls;
+
+  if (trace_is_enabled)
+    trace_events.push_back(
+      TraceEvent{actual_section_name,
+                 data.index,
+                 1e6 * internal::TimerImplementation::to_seconds(
+                         scope->start_time - reference_time),
+                 1e6 * wall_time});
+
+  data.active_scopes.erase(scope);
 }
 
 
@@ -1010,6 +1091,287 @@ TimerOutput::print_wall_time_statistics(const MPI_Comm mpi_comm,
 
 
 
+template <class Archive>
+void
+TimerOutput::TraceEvent::serialize(Archive &ar, const unsigned int)
+{
+  ar &name &thread &start &duration;
+}
+
+
+
+namespace internal
+{
+  namespace TimerImplementation
+  {
+    namespace
+    {
+      /**
+       * Data of the nested sections of all threads on a single rank, indexed
+       * by the index of the thread and the path of the section. The stored
+       * values are the accumulated wall time and the number of calls.
+       */
+      using NestedData =
+        std::map<std::pair<unsigned int, std::vector<std::string>>,
+                 std::pair<double, unsigned int>>;
+
+      /**
+       * Replace the characters that have a special meaning in the folded
+       * stack format in the name of a section.
+       */
+      std::string
+      folded_stack_name(const std::string &name)
+      {
+        std::string result = name;
+        for (char &c : result)
+          if (c == ';')
+            c = ',';
+          else if (c == '\n')
+            c = ' ';
+        return result;
+      }
+
+      /**
+       * Escape the name of a section for output as a JSON string.
+       */
+      std::string
+      json_escaped_name(const std::string &name)
+      {
+        std::ostringstream result;
+        for (const char c : name)
+          if (c == '"' || c == '\\')
+            result << '\\' << c;
+          else if (static_cast<unsigned char>(c) < 0x20)
+            result << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                   << static_cast<unsigned int>(c);
+          else
+            result << c;
+        return result.str();
+      }
+
+      /**
+       * Convert the trees of nested sections of all threads into a list
+       * indexed by the path of each section. Sections that have been entered
+       * but not yet left are skipped.
+       */
+      template <typename ThreadDataMap>
+      NestedData
+      collect_nested_data(const ThreadDataMap &thread_data)
+      {
+        NestedData result;
+        for (const auto &thread : thread_data)
+          {
+            const auto &nested_sections = thread.second.nested_sections;
+            for (unsigned int i = 1; i < nested_sections.size(); ++i)
+              if (nested_sections[i].n_calls > 0)
+                {
+                  std::vector<std::string> path;
+                  for (unsigned int s = i; s != 0;)
+                    {
+                      path.push_back(nested_sections[s].name);
+                      s = nested_sections[s].parent;
+                    }
+                  std::reverse(path.begin(), path.end());
+
+                  result[{thread.second.index, path}] = {
+                    nested_sections[i].total_wall_time,
+                    nested_sections[i].n_calls};
+                }
+          }
+        return result;
+      }
+    } // namespace
+  }   // namespace TimerImplementation
+} // namespace internal
+
+
+
+void
+TimerOutput::print_hierarchical_summary(const MPI_Comm mpi_comm) const
+{
+  // we are going to change the precision and width of output below. store the
+  // old values so the get restored when exiting this function
+  const boost::io::ios_base_all_saver restore_stream(out_stream.get_stream());
+
+  internal::TimerImplementation::NestedData local_data;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    local_data =
+      internal::TimerImplementation::collect_nested_data(thread_data);
+  }
+
+  const std::vector<internal::TimerImplementation::NestedData> all_data =
+    Utilities::MPI::all_gather(mpi_comm, local_data);
+
+  // collect the times of all ranks for each section, where ranks that never
+  // entered a section contribute zero time
+  std::map<std::pair<unsigned int, std::vector<std::string>>,
+           std::pair<std::vector<double>, unsigned int>>
+    section_data;
+  for (unsigned int rank = 0; rank < all_data.size(); ++rank)
+    for (const auto &section : all_data[rank])
+      {
+        auto &data = section_data[section.first];
+        data.first.resize(all_data.size(), 0.);
+        data.first[rank] = section.second.first;
+        data.second      = std::max(data.second, section.second.second);
+      }
+
+  // get the maximum width among all sections, including the indentation
+  unsigned int max_width = 0;
+  for (const auto &section : section_data)
+    max_width = std::max(max_width,
+                         static_cast<unsigned int>(
+                           2 * (section.first.second.size() - 1) +
+                           section.first.second.back().size()));
+
+  // 29 is the default width until | character
+  max_width = std::max(max_width + 1, static_cast<unsigned int>(29));
+  const std::string separator = "+" + std::string(max_width + 1, '-') +
+                                "+-----------+------------+------------+"
+                                "------------+\n";
+
+  unsigned int current_thread = numbers::invalid_unsigned_int;
+  for (const auto &section : section_data)
+    {
+      if (section.first.first != current_thread)
+        {
+          if (current_thread != numbers::invalid_unsigned_int)
+            out_stream << separator;
+          current_thread = section.first.first;
+
+          std::string header =
+            "Nested sections on thread " + std::to_string(current_thread);
+          header.resize(max_width, ' ');
+          out_stream << '\n'
+                     << separator << "| " << header
+                     << "| no. calls |   min time |   avg time |   max time |\n"
+                     << separator;
+        }
+
+      const std::vector<double> &times = section.second.first;
+      double                     min_time = times[0], max_time = times[0];
+      double                     avg_time = 0.;
+      for (const double time : times)
+        {
+          min_time = std::min(min_time, time);
+          max_time = std::max(max_time, time);
+          avg_time += time;
+        }
+      avg_time /= times.size();
+
+      std::string name_out(2 * (section.first.second.size() - 1), ' ');
+      name_out += section.first.second.back();
+      name_out.resize(max_width, ' ');
+      out_stream << "| " << name_out << "| " << std::setw(9)
+                 << section.second.second << " |";
+      for (const double time : {min_time, avg_time, max_time})
+        out_stream << std::setw(10) << std::setprecision(4) << std::right
+                   << time << "s |";
+      out_stream << '\n';
+    }
+  if (current_thread != numbers::invalid_unsigned_int)
+    out_stream << separator;
+}
+
+
+
+void
+TimerOutput::write_folded_stacks(std::ostream  &out,
+                                 const MPI_Comm mpi_comm) const
+{
+  internal::TimerImplementation::NestedData local_data;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    local_data =
+      internal::TimerImplementation::collect_nested_data(thread_data);
+  }
+
+  const std::vector<internal::TimerImplementation::NestedData> all_data =
+    Utilities::MPI::gather(mpi_comm, local_data);
+
+  if (Utilities::MPI::this_mpi_process(mpi_comm) != 0)
+    return;
+
+  // sum the times over all ranks and subtract the time spent in the
+  // children from each section
+  std::map<std::pair<unsigned int, std::vector<std::string>>, double>
+               exclusive_times;
+  unsigned int n_threads = 0;
+  for (const auto &rank_data : all_data)
+    for (const auto &section : rank_data)
+      {
+        exclusive_times[section.first] += section.second.first;
+        n_threads = std::max(n_threads, section.first.first + 1);
+
+        if (section.first.second.size() > 1)
+          {
+            auto parent = section.first;
+            parent.second.pop_back();
+            exclusive_times[parent] -= section.second.first;
+          }
+      }
+
+  for (const auto &section : exclusive_times)
+    {
+      if (n_threads > 1)
+        out << "thread " << section.first.first << ';';
+      for (unsigned int i = 0; i < section.first.second.size(); ++i)
+        out << (i > 0 ? ";" : "")
+            << internal::TimerImplementation::folded_stack_name(
+                 section.first.second[i]);
+      out << ' ' << std::max(std::llround(1e6 * section.second), 0LL) << '\n';
+    }
+  out << std::flush;
+}
+
+
+
+void
+TimerOutput::record_trace_events(const bool record)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  trace_is_enabled = record;
+}
+
+
+
+void
+TimerOutput::write_chrome_trace(std::ostream  &out,
+                                const MPI_Comm mpi_comm) const
+{
+  std::vector<TraceEvent> local_events;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    local_events = trace_events;
+  }
+
+  const std::vector<std::vector<TraceEvent>> all_events =
+    Utilities::MPI::gather(mpi_comm, local_events);
+
+  if (Utilities::MPI::this_mpi_process(mpi_comm) != 0)
+    return;
+
+  const boost::io::ios_base_all_saver restore_stream(out);
+  out << std::fixed << std::setprecision(3);
+
+  out << "{\"traceEvents\": [";
+  bool first = true;
+  for (unsigned int rank = 0; rank < all_events.size(); ++rank)
+    for (const TraceEvent &event : all_events[rank])
+      {
+        out << (first ? "\n" : ",\n") << "{\"name\": \""
+            << internal::TimerImplementation::json_escaped_name(event.name)
+            << "\", \"ph\": \"X\", \"pid\": " << rank
+            << ", \"tid\": " << event.thread << ", \"ts\": " << event.start
+            << ", \"dur\": " << event.duration << '}';
+        first = false;
+      }
+  out << "\n],\n\"displayTimeUnit\": \"ms\"}\n" << std::flush;
+}
+
+
+
 void
 TimerOutput::disable_output()
 {
@@ -1032,6 +1394,9 @@ TimerOutput::reset()
   std::lock_guard<std::mutex> lock(mutex);
   sections.clear();
   active_sections.clear();
+  thread_data.clear();
+  trace_events.clear();
+  reference_time = std::chrono::steady_clock::now();
   timer_all.restart();
 }
 
@@ -37,11 +37,13 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <bitset>
 #include <cctype>
 #include <cmath>
 #include <cstddef>
 #include <cstdio>
+#include <cstdlib>
 #include <ctime>
 #include <fstream>
 #include <iomanip>
@@ -54,6 +56,10 @@
 #  include <unistd.h>
 #endif
 
+#ifdef __linux__
+#  include <sys/mman.h>
+#endif
+
 #ifndef DEAL_II_MSVC
 // On Unix-type systems, we use posix_memalign:
 #  include <cstdlib>
@@ -962,6 +968,7 @@ namespace Utilities
     get_memory_stats(MemoryStats &stats)
     {
       stats.VmPeak = stats.VmSize = stats.VmHWM = stats.VmRSS = 0;
+      stats.AnonHugePages                                    = 0;
 
       // parsing /proc/self/stat would be a
       // lot easier, but it does not contain
@@ -987,6 +994,19 @@ namespace Utilities
 
           getline(file, line);
         }
+
+      // the memory backed by transparent huge pages is not part of
+      // /status, but summarized in /smaps_rollup
+      std::ifstream rollup_file("/proc/self/smaps_rollup");
+      while (rollup_file >> name)
+        {
+          if (name == "AnonHugePages:")
+            {
+              rollup_file >> stats.AnonHugePages;
+              break;
+            }
+          getline(rollup_file, line);
+        }
 #endif
     }
 
@@ -1038,9 +1058,81 @@ namespace Utilities
 
 
 
+    namespace
+    {
+      /**
+       * The size of huge pages on the architectures supporting transparent
+       * huge pages.
+       */
+      constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+      /**
+       * Return the initial threshold for the use of huge pages, as given by
+       * the environment variable DEAL_II_HUGE_PAGE_THRESHOLD.
+       */
+      std::size_t
+      get_default_huge_page_threshold()
+      {
+        if (const char *penv = std::getenv("DEAL_II_HUGE_PAGE_THRESHOLD"))
+          {
+            try
+              {
+                return string_to_int(std::string(penv));
+              }
+            catch (...)
+              {
+                AssertThrow(
+                  false,
+                  ExcMessage(
+                    std::string(
+                      "When specifying the <DEAL_II_HUGE_PAGE_THRESHOLD> "
+                      "environment variable, it needs to be something that "
+                      "can be interpreted as an integer. The text you have "
+                      "in the environment variable is <") +
+                    penv + ">"));
+              }
+          }
+        return 0;
+      }
+
+      std::atomic<std::size_t> huge_page_threshold(
+        get_default_huge_page_threshold());
+    } // namespace
+
+
+
+    void
+    set_huge_page_threshold(const std::size_t threshold)
+    {
+      huge_page_threshold = threshold;
+    }
+
+
+
+    std::size_t
+    get_huge_page_threshold()
+    {
+      return huge_page_threshold;
+    }
+
+
+
     void
     posix_memalign(void **memptr, std::size_t alignment, std::size_t size)
     {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+      // align large memory blocks to huge pages and round their size up to
+      // a multiple of the huge page size, so that all of the block can be
+      // backed by huge pages without sharing them with other allocations
+      const std::size_t threshold = huge_page_threshold;
+      const bool use_huge_pages   = threshold > 0 && size >= threshold;
+      if (use_huge_pages)
+        {
+          alignment = std::max(alignment, huge_page_size);
+          size = (size + huge_page_size - 1) / huge_page_size * huge_page_size;
+        }
+#endif
+
       // Strictly speaking, one can call both posix_memalign() and malloc()
       // with size==0. This is documented as returning a pointer that can
       // be given to free(), but for which using it is otherwise undefined.
@@ -1054,6 +1146,13 @@ namespace Utilities
 
           AssertThrow(ierr == 0, ExcOutOfMemory(size));
           AssertThrow(*memptr != nullptr, ExcOutOfMemory(size));
+
+#  if defined(__linux__) && defined(MADV_HUGEPAGE)
+          // this is only a hint, so failure (e.g., when transparent huge
+          // pages are disabled in the kernel) is not an error
+          if (use_huge_pages)
+            madvise(*memptr, size, MADV_HUGEPAGE);
+#  endif
 #else
           // Windows does not appear to have posix_memalign. just use the
           // regular malloc in that case
@@ -0,0 +1,337 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/cell_cost_model.h>
+
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace parallel
+{
+  template <int dim, int spacedim>
+  CellCostModel<dim, spacedim>::CellCostModel(
+    const parallel::TriangulationBase<dim, spacedim> &triangulation,
+    const CategoryFunction                           &category_function,
+    const double                                      smoothing)
+    : triangulation(triangulation)
+    , category_function(category_function)
+    , smoothing(smoothing)
+    , reference_cost(0.)
+    , particle_cost(-1.)
+    , recorded_particle_time(0.)
+    , recorded_particles(0.)
+  {
+    Assert(smoothing > 0. && smoothing <= 1.,
+           ExcMessage("The smoothing factor must be in the range (0,1]."));
+
+    connection = triangulation.signals.weight.connect(
+      [this](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+             const CellStatus status) -> unsigned int {
+        return this->weighting_callback(cell, status);
+      });
+  }
+
+
+
+  template <int dim, int spacedim>
+  CellCostModel<dim, spacedim>::~CellCostModel()
+  {
+    connection.disconnect();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  CellCostModel<dim, spacedim>::set_particle_count_function(
+    const ParticleCountFunction &particle_count_function)
+  {
+    this->particle_count_function = particle_count_function;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  CellCostModel<dim, spacedim>::record_cell_cost(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const double                                                wall_time)
+  {
+    Assert(cell->is_active() && cell->is_locally_owned(),
+           ExcMessage("Costs can only be recorded for locally owned cells."));
+
+    // attribute the time spent on particles to the particle cost if we
+    // already know it, and the rest to the cell's category
+    double cell_time = wall_time;
+    if (particle_count_function)
+      {
+        const unsigned int n_particles = particle_count_function(cell);
+        if (particle_cost >= 0.)
+          cell_time = std::max(cell_time - n_particles * particle_cost, 0.);
+      }
+
+    record_category_cost(get_category(cell), 1, cell_time);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  CellCostModel<dim, spacedim>::record_category_cost(
+    const unsigned int category,
+    const unsigned int n_cells,
+    const double       wall_time)
+  {
+    Assert(wall_time >= 0., ExcMessage("The wall time must not be negative."));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (category >= recorded_category_times.size())
+      {
+        recorded_category_times.resize(category + 1, 0.);
+        recorded_category_cells.resize(category + 1, 0.);
+      }
+    recorded_category_times[category] += wall_time;
+    recorded_category_cells[category] += n_cells;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  CellCostModel<dim, spacedim>::record_particle_cost(
+    const unsigned int n_particles,
+    const double       wall_time)
+  {
+    Assert(wall_time >= 0., ExcMessage("The wall time must not be negative."));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    recorded_particle_time += wall_time;
+    recorded_particles += n_particles;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  CellCostModel<dim, spacedim>::update()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const MPI_Comm mpi_comm = triangulation.get_mpi_communicator();
+
+    // make sure all processes know about the same categories, then sum the
+    // recorded data of all processes in one reduction
+    const unsigned int n_categories = Utilities::MPI::max(
+      static_cast<unsigned int>(
+        std::max(category_costs.size(), recorded_category_times.size())),
+      mpi_comm);
+
+    std::vector<double> recorded_data(2 * n_categories + 2, 0.);
+    std::copy(recorded_category_times.begin(),
+              recorded_category_times.end(),
+              recorded_data.begin());
+    std::copy(recorded_category_cells.begin(),
+              recorded_category_cells.end(),
+              recorded_data.begin() + n_categories);
+    recorded_data[2 * n_categories]     = recorded_particle_time;
+    recorded_data[2 * n_categories + 1] = recorded_particles;
+    Utilities::MPI::sum(recorded_data, mpi_comm, recorded_data);
+
+    const auto average = [this](const double old_cost, const double new_cost) {
+      return (old_cost < 0.) ? new_cost :
+                               smoothing * new_cost + (1. - smoothing) * old_cost;
+    };
+
+    category_costs.resize(n_categories, -1.);
+    for (unsigned int c = 0; c < n_categories; ++c)
+      if (recorded_data[n_categories + c] > 0.)
+        category_costs[c] =
+          average(category_costs[c],
+                  recorded_data[c] / recorded_data[n_categories + c]);
+
+    // all weights are relative to the cheapest measured category
+    reference_cost = std::numeric_limits<double>::max();
+    for (const double cost : category_costs)
+      if (cost > 0.)
+        reference_cost = std::min(reference_cost, cost);
+    if (reference_cost == std::numeric_limits<double>::max())
+      reference_cost = 0.;
+
+    if (recorded_data[2 * n_categories + 1] > 0.)
+      particle_cost =
+        average(particle_cost,
+                recorded_data[2 * n_categories] /
+                  recorded_data[2 * n_categories + 1]);
+
+    recorded_category_times.clear();
+    recorded_category_cells.clear();
+    recorded_particle_time = 0.;
+    recorded_particles     = 0.;
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  CellCostModel<dim, spacedim>::get_category_cost(
+    const unsigned int category) const
+  {
+    // categories without measurements are assumed to be as expensive as the
+    // cheapest measured one, rather than free
+    if (category < category_costs.size() && category_costs[category] >= 0.)
+      return category_costs[category];
+    else
+      return reference_cost;
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  CellCostModel<dim, spacedim>::get_particle_cost() const
+  {
+    return std::max(particle_cost, 0.);
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  CellCostModel<dim, spacedim>::predicted_cost(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell) const
+  {
+    double cost = get_category_cost(get_category(cell));
+    if (particle_count_function)
+      cost += particle_count_function(cell) * get_particle_cost();
+    return cost;
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  CellCostModel<dim, spacedim>::predicted_local_cost() const
+  {
+    double local_cost = 0.;
+    for (const auto &cell : triangulation.active_cell_iterators())
+      if (cell->is_locally_owned())
+        local_cost += predicted_cost(cell);
+    return local_cost;
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  CellCostModel<dim, spacedim>::predicted_imbalance() const
+  {
+    const Utilities::MPI::MinMaxAvg cost =
+      Utilities::MPI::min_max_avg(predicted_local_cost(),
+                                  triangulation.get_mpi_communicator());
+    if (cost.avg > 0.)
+      return std::max(cost.max / cost.avg - 1., 0.);
+    else
+      return 0.;
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  CellCostModel<dim, spacedim>::needs_repartitioning(
+    const double       migration_time,
+    const unsigned int n_cost_evaluations) const
+  {
+    const Utilities::MPI::MinMaxAvg cost =
+      Utilities::MPI::min_max_avg(predicted_local_cost(),
+                                  triangulation.get_mpi_communicator());
+
+    // with a perfect partition, every process would need the average time,
+    // so the slowest process would save the difference to the maximum
+    return (cost.max - cost.avg) * n_cost_evaluations > migration_time;
+  }
+
+
+
+  template <int dim, int spacedim>
+  unsigned int
+  CellCostModel<dim, spacedim>::get_category(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell) const
+  {
+    return category_function ? category_function(cell) : 0;
+  }
+
+
+
+  template <int dim, int spacedim>
+  unsigned int
+  CellCostModel<dim, spacedim>::weighting_callback(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const CellStatus                                            status) const
+  {
+    // without any measurements, all cells get the same weight
+    if (reference_cost == 0.)
+      return weight_resolution;
+
+    double cost = 0.;
+    switch (status)
+      {
+        case CellStatus::cell_will_persist:
+        case CellStatus::cell_invalid:
+          cost = predicted_cost(cell);
+          break;
+
+        case CellStatus::cell_will_be_refined:
+          // the function is called once for every future child with the
+          // parent cell, and we assume that the children belong to the same
+          // category as the parent and share its particles
+          cost = get_category_cost(get_category(cell));
+          if (particle_count_function)
+            cost += get_particle_cost() * particle_count_function(cell) /
+                    cell->reference_cell().n_isotropic_children();
+          break;
+
+        case CellStatus::children_will_be_coarsened:
+          // the function is called for the future parent, which gets the
+          // category of its first child and the particles of all children
+          cost = get_category_cost(get_category(cell->child(0)));
+          if (particle_count_function)
+            for (const auto &child : cell->child_iterators())
+              cost += get_particle_cost() * particle_count_function(child);
+          break;
+
+        default:
+          DEAL_II_ASSERT_UNREACHABLE();
+      }
+
+    return static_cast<unsigned int>(
+      std::min(std::round(weight_resolution * cost / reference_cost),
+               static_cast<double>(std::numeric_limits<int>::max())));
+  }
+} // namespace parallel
+
+
+// explicit instantiations
+#include "distributed/cell_cost_model.inst"
+
+DEAL_II_NAMESPACE_CLOSE
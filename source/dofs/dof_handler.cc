@@ -34,7 +34,11 @@
 #include <deal.II/grid/tria_iterator.h>
 #include <deal.II/grid/tria_levels.h>
 
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
 #include <algorithm>
+#include <fstream>
 #include <memory>
 #include <set>
 #include <unordered_set>
@@ -2185,40 +2189,7 @@ void DoFHandler<dim, spacedim>::distribute_dofs(
   //
   // register the new finite element collection
   //
-  // don't create a new object if the one we have is identical
-  if (this->fe_collection != ff)
-    {
-      this->fe_collection = hp::FECollection<dim, spacedim>(ff);
-
-      const bool contains_multiple_fes = (this->fe_collection.size() > 1);
-
-      // disable hp-mode if only a single finite element has been registered
-      if (hp_capability_enabled && !contains_multiple_fes)
-        {
-          hp_capability_enabled = false;
-
-          // unsubscribe connections to signals that are only relevant for
-          // hp-mode, since we only have a single element here
-          for (auto &connection : this->tria_listeners_for_transfer)
-            connection.disconnect();
-          this->tria_listeners_for_transfer.clear();
-
-          // release active and future finite element tables
-          this->hp_cell_active_fe_indices.clear();
-          this->hp_cell_active_fe_indices.shrink_to_fit();
-          this->hp_cell_future_fe_indices.clear();
-          this->hp_cell_future_fe_indices.shrink_to_fit();
-        }
-
-      // re-enabling hp-mode is not permitted since the active and future FE
-      // tables are no longer available
-      AssertThrow(
-        hp_capability_enabled || !contains_multiple_fes,
-        ExcMessage(
-          "You cannot re-enable hp-capabilities after you registered a single "
-          "finite element. Please call reinit() or create a new DoFHandler "
-          "object instead."));
-    }
+  set_fe(ff);
 
   //
   // enumerate all degrees of freedom
@@ -2283,6 +2254,145 @@ void DoFHandler<dim, spacedim>::distribute_dofs(
 
 
 
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void DoFHandler<dim, spacedim>::set_fe(
+  const hp::FECollection<dim, spacedim> &ff)
+{
+  // don't create a new object if the one we have is identical
+  if (this->fe_collection != ff)
+    {
+      this->fe_collection = hp::FECollection<dim, spacedim>(ff);
+
+      const bool contains_multiple_fes = (this->fe_collection.size() > 1);
+
+      // disable hp-mode if only a single finite element has been registered
+      if (hp_capability_enabled && !contains_multiple_fes)
+        {
+          hp_capability_enabled = false;
+
+          // unsubscribe connections to signals that are only relevant for
+          // hp-mode, since we only have a single element here
+          for (auto &connection : this->tria_listeners_for_transfer)
+            connection.disconnect();
+          this->tria_listeners_for_transfer.clear();
+
+          // release active and future finite element tables
+          this->hp_cell_active_fe_indices.clear();
+          this->hp_cell_active_fe_indices.shrink_to_fit();
+          this->hp_cell_future_fe_indices.clear();
+          this->hp_cell_future_fe_indices.shrink_to_fit();
+        }
+
+      // re-enabling hp-mode is not permitted since the active and future FE
+      // tables are no longer available
+      AssertThrow(
+        hp_capability_enabled || !contains_multiple_fes,
+        ExcMessage(
+          "You cannot re-enable hp-capabilities after you registered a single "
+          "finite element. Please call reinit() or create a new DoFHandler "
+          "object instead."));
+    }
+}
+
+
+
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void DoFHandler<dim, spacedim>::save(const std::string &filename) const
+{
+  Assert(this->tria != nullptr,
+         ExcMessage("You need to set the Triangulation in the DoFHandler "
+                    "before you can save it."));
+
+  std::string fname = filename;
+  if (const auto tria = dynamic_cast<
+        const parallel::TriangulationBase<dim, spacedim> *>(&*this->tria))
+    fname += "." + Utilities::int_to_string(
+                     Utilities::MPI::this_mpi_process(
+                       tria->get_mpi_communicator()));
+
+  std::ofstream out(fname, std::ios::binary);
+  AssertThrow(out.fail() == false, ExcIO());
+
+  // start with a tag and a version number of the format, which is checked
+  // when loading the data. the layout of the remaining data depends on
+  // whether hp-capabilities are enabled, so store that flag as well
+  boost::archive::binary_oarchive oa(out, boost::archive::no_header);
+  const std::string  format_name    = "deal.II DoFHandler";
+  const unsigned int format_version = 2;
+  const bool         hp_capability  = hp_capability_enabled;
+  oa << format_name << format_version << hp_capability;
+  save(oa, format_version);
+}
+
+
+
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void DoFHandler<dim, spacedim>::load(
+  const std::string                  &filename,
+  const FiniteElement<dim, spacedim> &fe)
+{
+  this->load(filename, hp::FECollection<dim, spacedim>(fe));
+}
+
+
+
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void DoFHandler<dim, spacedim>::load(
+  const std::string                     &filename,
+  const hp::FECollection<dim, spacedim> &ff)
+{
+  Assert(this->tria != nullptr,
+         ExcMessage("You need to set the Triangulation in the DoFHandler "
+                    "using reinit() or in the constructor before you can "
+                    "load the degrees of freedom."));
+  Assert(ff.size() > 0, ExcMessage("The given hp::FECollection is empty!"));
+
+  std::string fname = filename;
+  if (const auto tria = dynamic_cast<
+        const parallel::TriangulationBase<dim, spacedim> *>(&*this->tria))
+    fname += "." + Utilities::int_to_string(
+                     Utilities::MPI::this_mpi_process(
+                       tria->get_mpi_communicator()));
+
+  std::ifstream in(fname, std::ios::binary);
+  AssertThrow(in.fail() == false, ExcIO());
+
+  boost::archive::binary_iarchive ia(in, boost::archive::no_header);
+  std::string                     format_name;
+  unsigned int                    format_version;
+  bool                            hp_capability;
+  ia >> format_name >> format_version;
+  AssertThrow(format_name == "deal.II DoFHandler" && format_version == 2,
+              ExcMessage("The file <" + fname +
+                         "> does not contain the degrees of freedom of a "
+                         "DoFHandler in a format that can be read."));
+  ia >> hp_capability;
+
+  set_fe(ff);
+
+  // the data written in hp-mode has a different layout than the one written
+  // without, so the two modes need to agree
+  AssertThrow(hp_capability == hp_capability_enabled,
+              ExcMessage("The file <" + fname +
+                         "> was written by a DoFHandler " +
+                         (hp_capability ? "with" : "without") +
+                         " hp-capabilities, but the given finite elements " +
+                         (hp_capability_enabled ? "enable" : "disable") +
+                         " them in this DoFHandler."));
+
+  // the archive also contains the active and future FE indices in hp-mode,
+  // which overwrite the current ones
+  clear_space();
+  clear_mg_space();
+  load(ia, format_version);
+}
+
+
+
 template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void DoFHandler<dim, spacedim>::distribute_mg_dofs()
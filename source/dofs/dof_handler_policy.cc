@@ -15,6 +15,8 @@
 
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/partitioner.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/types.h>
@@ -35,6 +37,8 @@
 #include <deal.II/grid/tria_iterator.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <numeric>
@@ -1641,11 +1645,87 @@ namespace internal
 
 
 
+        /**
+         * An operation for process_dof_indices() that, like
+         * DoFIndexProcessor, visits the DoFs stored on the vertices, lines,
+         * quads, and the interior of a cell, but skips the vertices, lines,
+         * and quads that are not owned by the cell. The owner of each object
+         * is given in @p owners, indexed by the dimension of the object, as
+         * the position of the first cell in the enumeration that contains it,
+         * and @p position is the position of the current cell.
+         */
+        template <int dim, int spacedim>
+        struct OwnedDoFIndexProcessor
+        {
+          template <typename DoFProcessor>
+          DEAL_II_ALWAYS_INLINE void
+          process_vertex_dofs(DoFHandler<dim, spacedim> &dof_handler,
+                              const unsigned int         vertex_index,
+                              const types::fe_index      fe_index,
+                              types::global_dof_index  *&dof_indices_ptr,
+                              const DoFProcessor        &dof_processor) const
+          {
+            if (owners[0][vertex_index].load(std::memory_order_relaxed) ==
+                position)
+              DoFAccessorImplementation::Implementation::
+                DoFIndexProcessor<dim, spacedim>()
+                  .process_vertex_dofs(dof_handler,
+                                       vertex_index,
+                                       fe_index,
+                                       dof_indices_ptr,
+                                       dof_processor);
+          }
+
+          template <int structdim, typename DoFMapping, typename DoFProcessor>
+          DEAL_II_ALWAYS_INLINE void
+          process_dofs(const DoFHandler<dim, spacedim> &dof_handler,
+                       const unsigned int               obj_level,
+                       const unsigned int               obj_index,
+                       const types::fe_index            fe_index,
+                       const DoFMapping                &mapping,
+                       const std::integral_constant<int, structdim> dd,
+                       types::global_dof_index *&dof_indices_ptr,
+                       const DoFProcessor       &dof_processor) const
+          {
+            if constexpr (structdim < dim)
+              if (owners[structdim][obj_index].load(
+                    std::memory_order_relaxed) != position)
+                return;
+
+            DoFAccessorImplementation::Implementation::
+              DoFIndexProcessor<dim, spacedim>()
+                .process_dofs(dof_handler,
+                              obj_level,
+                              obj_index,
+                              fe_index,
+                              mapping,
+                              dd,
+                              dof_indices_ptr,
+                              dof_processor);
+          }
+
+          const std::array<std::vector<std::atomic<unsigned int>>, dim>
+                            &owners;
+          const unsigned int position;
+        };
+
+
+
         /**
          * Distribute degrees of freedom on all cells, or on cells with the
          * correct subdomain_id if the corresponding argument is not equal to
          * numbers::invalid_subdomain_id. Return the total number of dofs
          * distributed.
+         *
+         * The DoFs are numbered cell by cell, where the DoFs on vertices,
+         * lines, and quads shared between several cells get their indices
+         * from the first of these cells. Without hp-capabilities and on
+         * sufficiently large meshes, this numbering is computed in parallel
+         * on chunks of consecutive cells: We first determine the owning cell
+         * of each vertex, line, and quad, then count the DoFs each chunk
+         * owns, and finally number the DoFs of each chunk starting at the sum
+         * of the counts of all previous chunks. The result is the same as the
+         * one of the serial loop over all cells.
          */
         template <int dim, int spacedim>
         static types::global_dof_index
@@ -1656,13 +1736,25 @@ namespace internal
                  ExcMessage("Empty triangulation"));
 
           // distribute dofs on all cells excluding artificial ones
-          types::global_dof_index next_free_dof = 0;
-
-          for (auto cell : dof_handler.active_cell_iterators())
+          std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+            cells;
+          for (const auto &cell : dof_handler.active_cell_iterators())
             if (!cell->is_artificial() &&
                 ((subdomain_id == numbers::invalid_subdomain_id) ||
                  (cell->subdomain_id() == subdomain_id)))
-              {
+              cells.push_back(cell);
+
+          // with hp-capabilities, shared objects store DoFs for each finite
+          // element of the adjacent cells, and on small meshes the additional
+          // passes do not pay off, so number the DoFs in a single loop over
+          // the cells in these cases
+          const unsigned int chunk_size = 512;
+          if (dof_handler.hp_capability_enabled ||
+              cells.size() < 2 * chunk_size ||
+              MultithreadInfo::n_threads() == 1)
+            {
+              types::global_dof_index next_free_dof = 0;
+              for (const auto &cell : cells)
                 // feed the process_dof_indices function with an empty type
                 // `std::tuple<>`, as we do not want to retrieve any DoF
                 // indices here and rather modify the stored ones
@@ -1690,9 +1782,133 @@ namespace internal
                       }
                   },
                   false);
+              return next_free_dof;
+            }
+
+          const unsigned int n_chunks =
+            (cells.size() + chunk_size - 1) / chunk_size;
+          const auto apply_to_chunks = [&](const auto &function) {
+            dealii::parallel::apply_to_subranges(
+              0U,
+              n_chunks,
+              [&](const unsigned int begin, const unsigned int end) {
+                for (unsigned int chunk = begin; chunk < end; ++chunk)
+                  function(chunk,
+                           chunk * chunk_size,
+                           std::min<unsigned int>((chunk + 1) * chunk_size,
+                                                  cells.size()));
+              },
+              1);
+          };
+
+          // 1) determine for each vertex, line, and quad (in 3d) the first
+          // cell that contains it by taking the minimum over the positions of
+          // all cells containing it
+          const dealii::Triangulation<dim, spacedim> &tria =
+            dof_handler.get_triangulation();
+          const FiniteElement<dim, spacedim> &fe = dof_handler.get_fe();
+
+          std::array<std::vector<std::atomic<unsigned int>>, dim> owners;
+          owners[0] = std::vector<std::atomic<unsigned int>>(
+            fe.n_dofs_per_vertex() > 0 ? tria.n_vertices() : 0);
+          if constexpr (dim > 1)
+            owners[1] = std::vector<std::atomic<unsigned int>>(
+              fe.n_dofs_per_line() > 0 ? tria.n_raw_lines() : 0);
+          if constexpr (dim > 2)
+            owners[2] = std::vector<std::atomic<unsigned int>>(
+              fe.max_dofs_per_quad() > 0 ? tria.n_raw_quads() : 0);
+          for (auto &objects : owners)
+            for (auto &owner : objects)
+              owner.store(numbers::invalid_unsigned_int,
+                          std::memory_order_relaxed);
+
+          const auto claim = [](std::atomic<unsigned int> &owner,
+                                const unsigned int         position) {
+            unsigned int current = owner.load(std::memory_order_relaxed);
+            while (position < current &&
+                   !owner.compare_exchange_weak(current,
+                                                position,
+                                                std::memory_order_relaxed))
+              ;
+          };
+
+          apply_to_chunks([&](const unsigned int,
+                              const unsigned int begin,
+                              const unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+              {
+                const auto &cell = cells[i];
+                if (!owners[0].empty())
+                  for (const unsigned int v : cell->vertex_indices())
+                    claim(owners[0][cell->vertex_index(v)], i);
+                if constexpr (dim > 1)
+                  if (!owners[1].empty())
+                    for (const unsigned int l : cell->line_indices())
+                      claim(owners[1][cell->line_index(l)], i);
+                if constexpr (dim > 2)
+                  if (!owners[2].empty())
+                    for (const unsigned int f : cell->face_indices())
+                      claim(owners[2][cell->quad_index(f)], i);
               }
+          });
 
-          return next_free_dof;
+          // 2) count the DoFs owned by the cells of each chunk and mark them
+          // for the enumeration; since the DoFs of an object are only
+          // visited by its owner, the chunks do not access the same entries
+          std::vector<types::global_dof_index> chunk_offsets(n_chunks + 1, 0);
+          apply_to_chunks([&](const unsigned int chunk,
+                              const unsigned int begin,
+                              const unsigned int end) {
+            types::global_dof_index n_owned_dofs = 0;
+            for (unsigned int i = begin; i < end; ++i)
+              DoFAccessorImplementation::Implementation::process_dof_indices(
+                *cells[i],
+                std::make_tuple(),
+                cells[i]->active_fe_index(),
+                OwnedDoFIndexProcessor<dim, spacedim>{owners, i},
+                [&n_owned_dofs](auto &stored_index, auto) {
+                  if (stored_index == numbers::invalid_dof_index)
+                    {
+                      stored_index = enumeration_dof_index;
+                      ++n_owned_dofs;
+                    }
+                },
+                false);
+            chunk_offsets[chunk + 1] = n_owned_dofs;
+          });
+          std::partial_sum(chunk_offsets.begin(),
+                           chunk_offsets.end(),
+                           chunk_offsets.begin());
+          AssertThrow(
+            chunk_offsets.back() < enumeration_dof_index,
+            ExcMessage(
+              "You have reached the maximal number of degrees of "
+              "freedom that can be stored in the chosen data "
+              "type. In practice, this can only happen if you "
+              "are using 32-bit data types. You will have to "
+              "re-compile deal.II with the "
+              "`DEAL_II_WITH_64BIT_INDICES' flag set to `ON'."));
+
+          // 3) number the marked DoFs of each chunk in the same order as the
+          // serial loop
+          apply_to_chunks([&](const unsigned int chunk,
+                              const unsigned int begin,
+                              const unsigned int end) {
+            types::global_dof_index next_free_dof = chunk_offsets[chunk];
+            for (unsigned int i = begin; i < end; ++i)
+              DoFAccessorImplementation::Implementation::process_dof_indices(
+                *cells[i],
+                std::make_tuple(),
+                cells[i]->active_fe_index(),
+                OwnedDoFIndexProcessor<dim, spacedim>{owners, i},
+                [&next_free_dof](auto &stored_index, auto) {
+                  if (stored_index == enumeration_dof_index)
+                    stored_index = next_free_dof++;
+                },
+                false);
+          });
+
+          return chunk_offsets.back();
         }
 
 
@@ -1800,6 +2016,40 @@ namespace internal
         /* --------------------- renumber_dofs functionality ---------------- */
 
 
+        /**
+         * Apply the renumbering given by @p new_numbers to all valid DoF
+         * indices stored in the array @p dof_indices. This is the operation
+         * performed on the plain index arrays of a DoFHandler without
+         * hp-capabilities. Since each entry is renumbered independently of all
+         * others, the array is split into chunks that are processed in
+         * parallel, giving the same result as a serial loop.
+         *
+         * See renumber_dofs() for the meaning of the other arguments.
+         */
+        static void
+        renumber_dof_index_array(
+          const std::vector<types::global_dof_index> &new_numbers,
+          const IndexSet                             &indices_we_care_about,
+          std::vector<types::global_dof_index>       &dof_indices)
+        {
+          dealii::parallel::apply_to_subranges(
+            std::size_t(0),
+            dof_indices.size(),
+            [&](const std::size_t begin, const std::size_t end) {
+              for (std::size_t k = begin; k < end; ++k)
+                if (dof_indices[k] != numbers::invalid_dof_index)
+                  dof_indices[k] =
+                    ((indices_we_care_about.size() == 0) ?
+                       new_numbers[dof_indices[k]] :
+                       new_numbers[indices_we_care_about.index_within_set(
+                         dof_indices[k])]);
+            },
+            4096);
+        }
+
+
+
+
         /**
          * The part of the renumber_dofs() functionality that operates on faces.
          * This part is dimension dependent and so needs to be implemented in
@@ -1815,11 +2065,9 @@ namespace internal
           DoFHandler<dim, spacedim>                  &dof_handler)
         {
           for (unsigned int d = 1; d < dim; ++d)
-            for (auto &i : dof_handler.object_dof_indices[0][d])
-              if (i != numbers::invalid_dof_index)
-                i = ((indices_we_care_about.size() == 0) ?
-                       new_numbers[i] :
-                       new_numbers[indices_we_care_about.index_within_set(i)]);
+            renumber_dof_index_array(new_numbers,
+                                     indices_we_care_about,
+                                     dof_handler.object_dof_indices[0][d]);
         }
 
 
@@ -1840,22 +2088,23 @@ namespace internal
               // correct but also faster; note, however, that dof numbers
               // may be invalid_dof_index, namely when the appropriate
               // vertex/line/etc is unused
-              for (std::vector<types::global_dof_index>::iterator i =
-                     dof_handler.object_dof_indices[0][0].begin();
-                   i != dof_handler.object_dof_indices[0][0].end();
-                   ++i)
-                if (*i != numbers::invalid_dof_index)
-                  *i =
-                    (indices_we_care_about.size() == 0) ?
-                      (new_numbers[*i]) :
-                      (new_numbers[indices_we_care_about.index_within_set(*i)]);
-                else if (check_validity)
-                  // if index is invalid_dof_index: check if this one
-                  // really is unused
-                  Assert(dof_handler.get_triangulation().vertex_used(
-                           (i - dof_handler.object_dof_indices[0][0].begin()) /
-                           dof_handler.get_fe().n_dofs_per_vertex()) == false,
-                         ExcInternalError());
+              if constexpr (running_in_debug_mode())
+                if (check_validity)
+                  for (std::size_t i = 0;
+                       i < dof_handler.object_dof_indices[0][0].size();
+                       ++i)
+                    // if index is invalid_dof_index: check if this one
+                    // really is unused
+                    Assert(dof_handler.object_dof_indices[0][0][i] !=
+                               numbers::invalid_dof_index ||
+                             dof_handler.get_triangulation().vertex_used(
+                               i / dof_handler.get_fe().n_dofs_per_vertex()) ==
+                               false,
+                           ExcInternalError());
+
+              renumber_dof_index_array(new_numbers,
+                                       indices_we_care_about,
+                                       dof_handler.object_dof_indices[0][0]);
               return;
             }
 
@@ -1993,12 +2242,10 @@ namespace internal
               for (unsigned int level = 0;
                    level < dof_handler.object_dof_indices.size();
                    ++level)
-                for (auto &i : dof_handler.object_dof_indices[level][dim])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_dof_index_array(
+                  new_numbers,
+                  indices_we_care_about,
+                  dof_handler.object_dof_indices[level][dim]);
               return;
             }
 
@@ -2079,12 +2326,9 @@ namespace internal
           if (dof_handler.hp_capability_enabled == false)
             {
               for (unsigned int d = 1; d < dim; ++d)
-                for (auto &i : dof_handler.object_dof_indices[0][d])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_dof_index_array(new_numbers,
+                                         indices_we_care_about,
+                                         dof_handler.object_dof_indices[0][d]);
               return;
             }
 
@@ -2174,12 +2418,9 @@ namespace internal
           if (dof_handler.hp_capability_enabled == false)
             {
               for (unsigned int d = 1; d < dim; ++d)
-                for (auto &i : dof_handler.object_dof_indices[0][d])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_dof_index_array(new_numbers,
+                                         indices_we_care_about,
+                                         dof_handler.object_dof_indices[0][d]);
               return;
             }
 
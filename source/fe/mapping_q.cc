@@ -663,6 +663,26 @@ MappingQ<dim, spacedim>::transform_points_real_to_unit_cell(
   internal::MappingQImplementation::InverseQuadraticApproximation<dim, spacedim>
     inverse_approximation(support_points, unit_cell_support_points);
 
+  transform_points_real_to_unit_cell_internal(support_points,
+                                              inverse_approximation,
+                                              real_points,
+                                              unit_points);
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingQ<dim, spacedim>::transform_points_real_to_unit_cell_internal(
+  const ArrayView<const Point<spacedim>> &support_points,
+  const internal::MappingQImplementation::
+    InverseQuadraticApproximation<dim, spacedim> &inverse_approximation,
+  const ArrayView<const Point<spacedim>>         &real_points,
+  const ArrayView<Point<dim>>                    &unit_points) const
+{
+  Assert(dim == spacedim, ExcNotImplemented());
+  AssertDimension(real_points.size(), unit_points.size());
+
   const unsigned int n_points = real_points.size();
   const unsigned int n_lanes  = VectorizedArray<double>::size();
 
@@ -24,6 +24,7 @@
 #include <deal.II/fe/fe_tools.h>
 #include <deal.II/fe/fe_values.h>
 #include <deal.II/fe/mapping_q_cache.h>
+#include <deal.II/fe/mapping_q_internal.h>
 
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/petsc_vector.h>
@@ -47,6 +48,7 @@ MappingQCache<dim, spacedim>::MappingQCache(
   const MappingQCache<dim, spacedim> &mapping)
   : MappingQ<dim, spacedim>(mapping)
   , support_point_cache(mapping.support_point_cache)
+  , inverse_approximation_cache(mapping.inverse_approximation_cache)
   , uses_level_info(mapping.uses_level_info)
 {}
 
@@ -60,6 +62,7 @@ MappingQCache<dim, spacedim>::~MappingQCache()
   // invalid memory that has been left back by freeing an object of this
   // class.
   support_point_cache.reset();
+  inverse_approximation_cache.reset();
   clear_signal.disconnect();
 }
 
@@ -142,8 +145,10 @@ MappingQCache<dim, spacedim>::initialize(
     &compute_points_on_cell)
 {
   clear_signal.disconnect();
-  clear_signal = triangulation.signals.any_change.connect(
-    [&]() -> void { this->support_point_cache.reset(); });
+  clear_signal = triangulation.signals.any_change.connect([&]() -> void {
+    this->support_point_cache.reset();
+    this->inverse_approximation_cache.reset();
+  });
 
   support_point_cache =
     std::make_shared<std::vector<std::vector<std::vector<Point<spacedim>>>>>(
@@ -151,6 +156,20 @@ MappingQCache<dim, spacedim>::initialize(
   for (unsigned int l = 0; l < triangulation.n_levels(); ++l)
     (*support_point_cache)[l].resize(triangulation.n_raw_cells(l));
 
+  // The approximation of the inverse mapping is only used for dim ==
+  // spacedim, see MappingQ::transform_points_real_to_unit_cell()
+  if (dim == spacedim)
+    {
+      inverse_approximation_cache = std::make_shared<std::vector<std::vector<
+        internal::MappingQImplementation::InverseQuadraticApproximation<
+          dim,
+          spacedim>>>>(triangulation.n_levels());
+      for (unsigned int l = 0; l < triangulation.n_levels(); ++l)
+        (*inverse_approximation_cache)[l].resize(triangulation.n_raw_cells(l));
+    }
+  else
+    inverse_approximation_cache.reset();
+
   WorkStream::run(
     triangulation.begin(),
     triangulation.end(),
@@ -166,6 +185,14 @@ MappingQCache<dim, spacedim>::initialize(
       AssertDimension(
         (*support_point_cache)[cell->level()][cell->index()].size(),
         Utilities::pow(d, dim));
+
+      if (inverse_approximation_cache)
+        (*inverse_approximation_cache)[cell->level()][cell->index()] =
+          internal::MappingQImplementation::
+            InverseQuadraticApproximation<dim, spacedim>(
+              make_array_view(
+                (*support_point_cache)[cell->level()][cell->index()]),
+              this->unit_cell_support_points);
     },
     /* copier */ std::function<void(void *)>(),
     /* scratch_data */ nullptr,
@@ -703,11 +730,13 @@ template <int dim, int spacedim>
 std::size_t
 MappingQCache<dim, spacedim>::memory_consumption() const
 {
+  std::size_t memory = sizeof(*this);
   if (support_point_cache.get() != nullptr)
-    return sizeof(*this) +
-           MemoryConsumption::memory_consumption(*support_point_cache);
-  else
-    return sizeof(*this);
+    memory += MemoryConsumption::memory_consumption(*support_point_cache);
+  if (inverse_approximation_cache.get() != nullptr)
+    memory +=
+      MemoryConsumption::memory_consumption(*inverse_approximation_cache);
+  return memory;
 }
 
 
@@ -761,6 +790,57 @@ MappingQCache<dim, spacedim>::get_vertices(
 
 
 
+template <int dim, int spacedim>
+Point<dim>
+MappingQCache<dim, spacedim>::transform_real_to_unit_cell(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+  const Point<spacedim>                                      &p) const
+{
+  if (inverse_approximation_cache.get() == nullptr)
+    return MappingQ<dim, spacedim>::transform_real_to_unit_cell(cell, p);
+
+  Point<dim> p_unit;
+  transform_points_real_to_unit_cell(cell,
+                                     ArrayView<const Point<spacedim>>(&p, 1),
+                                     ArrayView<Point<dim>>(&p_unit, 1));
+  AssertThrow(p_unit[0] != std::numeric_limits<double>::lowest(),
+              (typename Mapping<dim, spacedim>::ExcTransformationFailed()));
+  return p_unit;
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingQCache<dim, spacedim>::transform_points_real_to_unit_cell(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+  const ArrayView<const Point<spacedim>>                     &real_points,
+  const ArrayView<Point<dim>>                                &unit_points) const
+{
+  if (inverse_approximation_cache.get() == nullptr)
+    {
+      MappingQ<dim, spacedim>::transform_points_real_to_unit_cell(cell,
+                                                                  real_points,
+                                                                  unit_points);
+      return;
+    }
+
+  Assert(uses_level_info || cell->is_active(), ExcInternalError());
+  AssertIndexRange(cell->level(), support_point_cache->size());
+  AssertIndexRange(cell->index(), (*support_point_cache)[cell->level()].size());
+
+  // work directly on the cached data, avoiding the copy made by
+  // compute_mapping_support_points() and the setup of the approximation of
+  // the inverse mapping done in MappingQ
+  this->transform_points_real_to_unit_cell_internal(
+    make_array_view((*support_point_cache)[cell->level()][cell->index()]),
+    (*inverse_approximation_cache)[cell->level()][cell->index()],
+    real_points,
+    unit_points);
+}
+
+
+
 //--------------------------- Explicit instantiations -----------------------
 #include "fe/mapping_q_cache.inst"
 
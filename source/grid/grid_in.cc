@@ -14,6 +14,7 @@
 
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/patterns.h>
 #include <deal.II/base/utilities.h>
 
@@ -34,10 +35,13 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <limits>
 #include <map>
+#include <type_traits>
+#include <unordered_map>
 
 #ifdef DEAL_II_WITH_ASSIMP
 #  include <assimp/Importer.hpp>  // C++ importer interface
@@ -130,6 +134,86 @@ namespace
     if (is_only_hypercube)
       GridTools::consistently_order_cells(cells);
   }
+
+  /**
+   * Read @p n_lines lines with @p n_numbers_per_line numbers each from the
+   * stream @p in, which reads from a copy of the string @p buffer, and store
+   * them in @p numbers. Reading starts at the first non-whitespace character
+   * after the current position of the stream, and the stream is advanced
+   * past the last line read.
+   *
+   * Since converting text to numbers is by far the most expensive part of
+   * reading large mesh files, the lines are only located in a quick serial
+   * scan of the buffer and then converted in parallel.
+   */
+  template <typename Number>
+  void
+  read_lines_in_parallel(std::istream        &in,
+                         const std::string   &buffer,
+                         const std::size_t    n_lines,
+                         const unsigned int   n_numbers_per_line,
+                         std::vector<Number> &numbers)
+  {
+    AssertThrow(in.fail() == false, ExcIO());
+
+    numbers.clear();
+    if (n_lines == 0)
+      return;
+
+    std::size_t position =
+      std::min(buffer.find_first_not_of(" \t\r\n",
+                                        static_cast<std::size_t>(in.tellg())),
+               buffer.size());
+    std::vector<std::size_t> line_starts(n_lines + 1);
+    for (std::size_t line = 0; line < n_lines; ++line)
+      {
+        AssertThrow(position < buffer.size(),
+                    ExcMessage("Unexpected end of the input while reading " +
+                               std::to_string(n_lines) + " lines."));
+        line_starts[line] = position;
+        position          = std::min(buffer.find('\n', position), buffer.size());
+        if (position < buffer.size())
+          ++position;
+      }
+    line_starts[n_lines] = position;
+
+    numbers.resize(n_lines * n_numbers_per_line);
+    parallel::apply_to_subranges(
+      std::size_t(0),
+      n_lines,
+      [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t line = begin; line < end; ++line)
+          {
+            const char *current  = buffer.data() + line_starts[line];
+            const char *line_end = buffer.data() + line_starts[line + 1];
+            for (unsigned int i = 0; i < n_numbers_per_line; ++i)
+              {
+                char *number_end;
+                if constexpr (std::is_floating_point_v<Number>)
+                  numbers[line * n_numbers_per_line + i] =
+                    std::strtod(current, &number_end);
+                else if constexpr (std::is_signed_v<Number>)
+                  numbers[line * n_numbers_per_line + i] =
+                    std::strtol(current, &number_end, 10);
+                else
+                  numbers[line * n_numbers_per_line + i] =
+                    std::strtoul(current, &number_end, 10);
+                AssertThrow(number_end != current && number_end <= line_end,
+                            ExcMessage(
+                              "Could not read " +
+                              std::to_string(n_numbers_per_line) +
+                              " numbers from the line <" +
+                              std::string(buffer.data() + line_starts[line],
+                                          line_end) +
+                              ">."));
+                current = number_end;
+              }
+          }
+      },
+      1024);
+
+    in.seekg(position);
+  }
 } // namespace
 
 template <int dim, int spacedim>
@@ -2098,22 +2182,41 @@ GridIn<dim, spacedim>::read_msh(std::istream &input_stream)
   std::string stripped_file;
 
   // Comments can be included by mesh generating software and must be deleted,
-  // a string is filed with the content of the file stripped of the comments
-  while (std::getline(input_stream, line))
-    {
-      if (line == "$Comments")
+  // a string is filed with the content of the file stripped of the comments.
+  // Reading the whole file at once is much faster than reading it line by
+  // line for large files.
+  {
+    std::ostringstream file_content;
+    file_content << input_stream.rdbuf();
+    stripped_file = file_content.str();
+
+    // find a line that consists of the given marker
+    const auto find_line = [&stripped_file](const std::string &marker,
+                                            std::size_t        position) {
+      for (position = stripped_file.find(marker, position);
+           position != std::string::npos;
+           position = stripped_file.find(marker, position + 1))
         {
-          while (std::getline(input_stream, line))
-            {
-              if (line == "$EndComments")
-                {
-                  break;
-                }
-            }
-          continue;
+          const std::size_t end = position + marker.size();
+          if ((position == 0 || stripped_file[position - 1] == '\n') &&
+              (end == stripped_file.size() || stripped_file[end] == '\n'))
+            return position;
         }
-      stripped_file += line + '\n';
-    }
+      return position;
+    };
+
+    for (std::size_t comment = find_line("$Comments", 0);
+         comment != std::string::npos;
+         comment = find_line("$Comments", comment))
+      {
+        const std::size_t end_comment = find_line("$EndComments", comment);
+        stripped_file.erase(comment,
+                            end_comment == std::string::npos ?
+                              std::string::npos :
+                              end_comment + std::string("$EndComments\n").size() -
+                                comment);
+      }
+  }
 
   // Restart reading the file normally since it has been stripped of comments
   std::istringstream in(stripped_file);
@@ -2321,7 +2424,8 @@ GridIn<dim, spacedim>::read_msh(std::istream &input_stream)
   // set up mapping between numbering
   // in msh-file (nod) and in the
   // vertices vector
-  std::map<int, int> vertex_indices;
+  std::unordered_map<int, int> vertex_indices;
+  vertex_indices.reserve(n_vertices);
 
   {
     unsigned int global_vertex = 0;
@@ -2344,15 +2448,32 @@ GridIn<dim, spacedim>::read_msh(std::istream &input_stream)
           }
 
         std::vector<int> vertex_numbers;
-        int              vertex_number;
         if (gmsh_file_format > 40)
-          for (unsigned long vertex_per_entity = 0;
-               vertex_per_entity < numNodes;
-               ++vertex_per_entity)
-            {
-              in >> vertex_number;
-              vertex_numbers.push_back(vertex_number);
-            }
+          {
+            // the format 4.1 lists the node tags of an entity block first
+            // and then the coordinates, one node per line, so we can read
+            // them in parallel
+            read_lines_in_parallel(
+              in, stripped_file, numNodes, 1, vertex_numbers);
+
+            if (parametric == 0)
+              {
+                std::vector<double> coordinates;
+                read_lines_in_parallel(
+                  in, stripped_file, numNodes, 3, coordinates);
+                for (unsigned long vertex_per_entity = 0;
+                     vertex_per_entity < numNodes;
+                     ++vertex_per_entity, ++global_vertex)
+                  {
+                    for (unsigned int d = 0; d < spacedim; ++d)
+                      vertices[global_vertex][d] =
+                        coordinates[3 * vertex_per_entity + d];
+                    vertex_indices[vertex_numbers[vertex_per_entity]] =
+                      global_vertex;
+                  }
+                continue;
+              }
+          }
 
         for (unsigned long vertex_per_entity = 0; vertex_per_entity < numNodes;
              ++vertex_per_entity, ++global_vertex)
@@ -2433,6 +2554,20 @@ GridIn<dim, spacedim>::read_msh(std::istream &input_stream)
   {
     static constexpr std::array<unsigned int, 8> local_vertex_numbering = {
       {0, 1, 5, 4, 2, 3, 7, 6}};
+
+    // in the format 4.x, all elements of an entity block have the same type
+    // and are given on one line each, so we can convert the numbers of a
+    // whole block in parallel and then read them from this array instead of
+    // the stream
+    std::vector<unsigned int> element_data;
+    std::size_t               element_data_position = 0;
+    const auto                read_index = [&](unsigned int &index) {
+      if (element_data_position < element_data.size())
+        index = element_data[element_data_position++];
+      else
+        in >> index;
+    };
+
     unsigned int global_cell = 0;
     for (int entity_block = 0; entity_block < n_entity_blocks; ++entity_block)
       {
@@ -2460,6 +2595,19 @@ GridIn<dim, spacedim>::read_msh(std::istream &input_stream)
             material_id = tag_maps[dimEntity][tagEntity];
           }
 
+        element_data.clear();
+        element_data_position = 0;
+        if (gmsh_file_format >= 40)
+          {
+            // the element tag followed by the nodes
+            const std::map<int, unsigned int> n_numbers_per_element = {
+              {1, 3}, {2, 4}, {3, 5}, {4, 5}, {5, 9}, {15, 2}};
+            const auto n_numbers = n_numbers_per_element.find(cell_type);
+            if (n_numbers != n_numbers_per_element.end())
+              read_lines_in_parallel(
+                in, stripped_file, numElements, n_numbers->second, element_data);
+          }
+
         for (unsigned int cell_per_entity = 0; cell_per_entity < numElements;
              ++cell_per_entity, ++global_cell)
           {
@@ -2533,8 +2681,8 @@ GridIn<dim, spacedim>::read_msh(std::istream &input_stream)
             else // file format version 4.0 and later
               {
                 // ignore tag
-                int tag;
-                in >> tag;
+                unsigned int tag;
+                read_index(tag);
 
                 if (cell_type == 1) // line
                   nod_num = 2;
@@ -2603,11 +2751,12 @@ GridIn<dim, spacedim>::read_msh(std::istream &input_stream)
                     // hypercube cells need to be reordered
                     if (vertices_per_cell ==
                         GeometryInfo<dim>::vertices_per_cell)
-                      in >> cell.vertices[dim == 3 ?
-                                            local_vertex_numbering[i] :
-                                            GeometryInfo<dim>::ucd_to_deal[i]];
+                      read_index(
+                        cell.vertices[dim == 3 ?
+                                        local_vertex_numbering[i] :
+                                        GeometryInfo<dim>::ucd_to_deal[i]]);
                     else
-                      in >> cell.vertices[i];
+                      read_index(cell.vertices[i]);
                   }
 
                 // to make sure that the cast won't fail
@@ -2643,8 +2792,8 @@ GridIn<dim, spacedim>::read_msh(std::istream &input_stream)
               // boundary info
               {
                 subcelldata.boundary_lines.emplace_back();
-                in >> subcelldata.boundary_lines.back().vertices[0] >>
-                  subcelldata.boundary_lines.back().vertices[1];
+                read_index(subcelldata.boundary_lines.back().vertices[0]);
+                read_index(subcelldata.boundary_lines.back().vertices[1]);
 
                 // to make sure that the cast won't fail
                 Assert(material_id <=
@@ -2695,7 +2844,7 @@ GridIn<dim, spacedim>::read_msh(std::istream &input_stream)
                   vertices_per_cell);
                 // for loop
                 for (unsigned int i = 0; i < vertices_per_cell; ++i)
-                  in >> subcelldata.boundary_quads.back().vertices[i];
+                  read_index(subcelldata.boundary_quads.back().vertices[i]);
 
                 // to make sure that the cast won't fail
                 Assert(material_id <=
@@ -2740,7 +2889,7 @@ GridIn<dim, spacedim>::read_msh(std::istream &input_stream)
                   }
                 else
                   {
-                    in >> node_index;
+                    read_index(node_index);
                   }
 
                 // we only care about boundary indicators assigned to
@@ -18,6 +18,7 @@
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_large_count.h>
 #include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
@@ -35,6 +36,8 @@
 #include <deal.II/grid/tria_iterator.h>
 #include <deal.II/grid/tria_levels.h>
 
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 
@@ -4946,6 +4949,36 @@ namespace internal
 
 
 
+      /**
+       * Compute the location of the vertices that are created in the middle
+       * of the given objects during refinement and store them at the given
+       * indices in the vertex array of the triangulation. Evaluating the
+       * manifold is the most expensive part of the refinement of curved
+       * meshes, so the objects are processed in parallel. Since the new
+       * vertices have already been numbered by the caller and every vertex is
+       * written by exactly one task, the result does not depend on the number
+       * of threads.
+       */
+      template <typename Iterator, int spacedim>
+      static void
+      compute_new_vertex_locations(
+        const std::vector<std::pair<Iterator, unsigned int>> &new_vertices,
+        const bool                                            use_interpolation,
+        std::vector<Point<spacedim>>                         &vertices)
+      {
+        dealii::parallel::apply_to_subranges(
+          0U,
+          static_cast<unsigned int>(new_vertices.size()),
+          [&](const unsigned int begin, const unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+              vertices[new_vertices[i].second] =
+                new_vertices[i].first->center(true, use_interpolation);
+          },
+          32);
+      }
+
+
+
       template <int dim, int spacedim>
       static typename Triangulation<dim, spacedim>::DistortedCellList
       execute_refinement_isotropic(Triangulation<dim, spacedim> &triangulation,
@@ -5061,6 +5094,11 @@ namespace internal
           typename Triangulation<dim, spacedim>::raw_line_iterator
             next_unused_line = triangulation.begin_raw_line();
 
+          std::vector<
+            std::pair<typename Triangulation<dim, spacedim>::line_iterator,
+                      unsigned int>>
+            new_line_vertices;
+
           for (; line != endl; ++line)
             if (line->user_flag_set())
               {
@@ -5076,7 +5114,7 @@ namespace internal
                          "enough."));
                 triangulation.vertices_used[next_unused_vertex] = true;
 
-                triangulation.vertices[next_unused_vertex] = line->center(true);
+                new_line_vertices.emplace_back(line, next_unused_vertex);
 
                 [[maybe_unused]] bool pair_found = false;
                 for (; next_unused_line != endl; ++next_unused_line)
@@ -5116,6 +5154,10 @@ namespace internal
 
                 line->clear_user_flag();
               }
+
+          compute_new_vertex_locations(new_line_vertices,
+                                       false,
+                                       triangulation.vertices);
         }
 
         reserve_space(triangulation.faces->lines, 0, n_single_lines);
@@ -5126,10 +5168,16 @@ namespace internal
         typename Triangulation<dim, spacedim>::raw_line_iterator
           next_unused_line = triangulation.begin_raw_line();
 
+        std::vector<
+          std::pair<typename Triangulation<dim, spacedim>::cell_iterator,
+                    unsigned int>>
+          new_cell_vertices;
+
         const auto create_children = [](auto         &triangulation,
                                         unsigned int &next_unused_vertex,
                                         auto         &next_unused_line,
                                         auto         &next_unused_cell,
+                                        auto         &new_cell_vertices,
                                         const auto   &cell) {
           const auto ref_case = cell->refine_flag_set();
           cell->clear_refine_flag();
@@ -5167,8 +5215,7 @@ namespace internal
 
               new_vertices[8] = next_unused_vertex;
 
-              triangulation.vertices[next_unused_vertex] =
-                cell->center(true, true);
+              new_cell_vertices.emplace_back(cell, next_unused_vertex);
             }
 
           std::array<typename Triangulation<dim, spacedim>::raw_line_iterator,
@@ -5372,6 +5419,12 @@ namespace internal
             typename Triangulation<dim, spacedim>::raw_cell_iterator
               next_unused_cell = triangulation.begin_raw(level + 1);
 
+            // first create the children of all cells on this level, then
+            // compute the new vertices in the cell centers, which requires
+            // the vertices on the refined lines to be in place
+            std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+              refined_cells;
+            new_cell_vertices.clear();
             for (const auto &cell :
                  triangulation.active_cell_iterators_on_level(level))
               if (cell->refine_flag_set())
@@ -5380,16 +5433,25 @@ namespace internal
                                   next_unused_vertex,
                                   next_unused_line,
                                   next_unused_cell,
+                                  new_cell_vertices,
                                   cell);
+                  refined_cells.push_back(cell);
+                }
 
-                  if (cell->reference_cell() == ReferenceCells::Quadrilateral &&
-                      check_for_distorted_cells &&
-                      has_distorted_children<dim, spacedim>(cell))
-                    cells_with_distorted_children.distorted_cells.push_back(
-                      cell);
+            compute_new_vertex_locations(new_cell_vertices,
+                                         true,
+                                         triangulation.vertices);
 
-                  triangulation.signals.post_refinement_on_cell(cell);
-                }
+            for (const auto &cell : refined_cells)
+              {
+                if (cell->reference_cell() == ReferenceCells::Quadrilateral &&
+                    check_for_distorted_cells &&
+                    has_distorted_children<dim, spacedim>(cell))
+                  cells_with_distorted_children.distorted_cells.push_back(
+                    cell);
+
+                triangulation.signals.post_refinement_on_cell(cell);
+              }
           }
 
         return cells_with_distorted_children;
@@ -6180,6 +6242,11 @@ namespace internal
             endl = triangulation.end_line();
           raw_line_iterator next_unused_line = triangulation.begin_raw_line();
 
+          std::vector<
+            std::pair<typename Triangulation<dim, spacedim>::line_iterator,
+                      unsigned int>>
+            new_line_vertices;
+
           for (; line != endl; ++line)
             {
               if (line->user_flag_set() == false)
@@ -6205,7 +6272,7 @@ namespace internal
               current_vertex =
                 get_next_unused_vertex(current_vertex,
                                        triangulation.vertices_used);
-              triangulation.vertices[current_vertex] = line->center(true);
+              new_line_vertices.emplace_back(line, current_vertex);
 
               children[0]->set_bounding_object_indices(
                 {line->vertex_index(0), current_vertex});
@@ -6226,6 +6293,10 @@ namespace internal
 
               line->clear_user_flag();
             }
+
+          compute_new_vertex_locations(new_line_vertices,
+                                       false,
+                                       triangulation.vertices);
         }
 
         // FACES (i.e., quads or triangles, or both)
@@ -6234,6 +6305,11 @@ namespace internal
             face = triangulation.begin_face(),
             endf = triangulation.end_face();
 
+          std::vector<
+            std::pair<typename Triangulation<dim, spacedim>::face_iterator,
+                      unsigned int>>
+            new_face_vertices;
+
           for (; face != endf; ++face)
             {
               if (face->user_flag_set() == false)
@@ -6316,8 +6392,7 @@ namespace internal
                                            triangulation.vertices_used);
                   vertex_indices[k++] = current_vertex;
 
-                  triangulation.vertices[current_vertex] =
-                    face->center(true, true);
+                  new_face_vertices.emplace_back(face, current_vertex);
                 }
 
               // 4) set new lines on these faces and their properties
@@ -6495,6 +6570,10 @@ namespace internal
 
               face->clear_user_flag();
             }
+
+          compute_new_vertex_locations(new_face_vertices,
+                                       true,
+                                       triangulation.vertices);
         }
 
         typename Triangulation<3, spacedim>::DistortedCellList
@@ -6507,6 +6586,17 @@ namespace internal
           {
             typename Triangulation<dim, spacedim>::raw_cell_iterator
               next_unused_cell = triangulation.begin_raw(level + 1);
+
+            // the new vertices in the cell centers require the vertices on
+            // the refined faces to be in place, and are in turn needed for
+            // the check for distorted cells below
+            std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+              refined_cells;
+            std::vector<
+              std::pair<typename Triangulation<dim, spacedim>::cell_iterator,
+                        unsigned int>>
+              new_cell_vertices;
+
             Assert(cell == triangulation.end() ||
                      cell->level() >= static_cast<int>(level),
                    ExcInternalError());
@@ -6684,8 +6774,7 @@ namespace internal
                                                  triangulation.vertices_used);
                         vertex_indices[k++] = current_vertex;
 
-                        triangulation.vertices[current_vertex] =
-                          cell->center(true, true);
+                        new_cell_vertices.emplace_back(cell, current_vertex);
                       }
                   }
 
@@ -7104,11 +7193,21 @@ namespace internal
                   }
                 }
 
+                refined_cells.push_back(cell);
+              }
+
+            compute_new_vertex_locations(new_cell_vertices,
+                                         true,
+                                         triangulation.vertices);
+
+            for (const auto &refined_cell : refined_cells)
+              {
                 if (check_for_distorted_cells &&
-                    has_distorted_children<dim, spacedim>(cell))
-                  cells_with_distorted_children.distorted_cells.push_back(cell);
+                    has_distorted_children<dim, spacedim>(refined_cell))
+                  cells_with_distorted_children.distorted_cells.push_back(
+                    refined_cell);
 
-                triangulation.signals.post_refinement_on_cell(cell);
+                triangulation.signals.post_refinement_on_cell(refined_cell);
               }
           }
 
@@ -13709,26 +13808,31 @@ template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::save(const std::string &file_basename) const
 {
-  // Save triangulation information.
+  // Save triangulation information. We use a binary archive, which stores
+  // the arrays of the triangulation as raw memory and is therefore much
+  // faster to write and read than a text archive.
   {
-    std::ofstream ofs_tria(file_basename + "_triangulation.data");
+    std::ofstream ofs_tria(file_basename + "_triangulation.data",
+                           std::ios::binary);
     AssertThrow(ofs_tria.fail() == false, ExcIO());
 
-    boost::archive::text_oarchive oa(ofs_tria, boost::archive::no_header);
+    boost::archive::binary_oarchive oa(ofs_tria, boost::archive::no_header);
     save(oa,
          internal::CellAttachedDataSerializer<dim, spacedim>::version_number);
   }
 
-  // Save attached data.
+  // Save attached data. The last entry denotes the format of the
+  // triangulation data; files written before it was introduced use a text
+  // archive.
   {
     std::ofstream ofs_info(file_basename + ".info");
     ofs_info
-      << "version nproc n_attached_fixed_size_objs n_attached_variable_size_objs n_active_cells"
+      << "version nproc n_attached_fixed_size_objs n_attached_variable_size_objs n_active_cells format"
       << std::endl
       << internal::CellAttachedDataSerializer<dim, spacedim>::version_number
       << " " << 1 << " " << this->cell_attached_data.pack_callbacks_fixed.size()
       << " " << this->cell_attached_data.pack_callbacks_variable.size() << " "
-      << this->n_global_active_cells() << std::endl;
+      << this->n_global_active_cells() << " binary" << std::endl;
   }
 
   this->save_attached_data(0, this->n_global_active_cells(), file_basename);
@@ -13745,19 +13849,11 @@ void Triangulation<dim, spacedim>::load(const std::string &file_basename)
   // overwrites everything:
   clear();
 
-  // Load triangulation information.
-  {
-    std::ifstream ifs_tria(file_basename + "_triangulation.data");
-    AssertThrow(ifs_tria.fail() == false, ExcIO());
-
-    boost::archive::text_iarchive ia(ifs_tria, boost::archive::no_header);
-    load(ia,
-         internal::CellAttachedDataSerializer<dim, spacedim>::version_number);
-  }
-
-  // Load attached data.
+  // Read the information about the attached data and the format of the
+  // triangulation data.
   unsigned int version, numcpus, attached_count_fixed, attached_count_variable,
     n_global_active_cells;
+  std::string format;
   {
     std::ifstream ifs_info(std::string(file_basename) + ".info");
     AssertThrow(ifs_info.fail() == false, ExcIO());
@@ -13765,6 +13861,35 @@ void Triangulation<dim, spacedim>::load(const std::string &file_basename)
     std::getline(ifs_info, firstline);
     ifs_info >> version >> numcpus >> attached_count_fixed >>
       attached_count_variable >> n_global_active_cells;
+    AssertThrow(ifs_info.fail() == false, ExcIO());
+    if (!(ifs_info >> format))
+      format = "text";
+  }
+
+  // Load triangulation information.
+  {
+    std::ifstream ifs_tria(file_basename + "_triangulation.data",
+                           std::ios::binary);
+    AssertThrow(ifs_tria.fail() == false, ExcIO());
+
+    if (format == "binary")
+      {
+        boost::archive::binary_iarchive ia(ifs_tria,
+                                           boost::archive::no_header);
+        load(ia,
+             internal::CellAttachedDataSerializer<dim,
+                                                  spacedim>::version_number);
+      }
+    else
+      {
+        AssertThrow(format == "text",
+                    ExcMessage("Unknown format <" + format +
+                               "> of the triangulation data."));
+        boost::archive::text_iarchive ia(ifs_tria, boost::archive::no_header);
+        load(ia,
+             internal::CellAttachedDataSerializer<dim,
+                                                  spacedim>::version_number);
+      }
   }
 
   AssertThrow(numcpus == 1,
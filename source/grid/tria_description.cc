@@ -27,6 +27,11 @@
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_description.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -1166,6 +1171,384 @@ namespace TriangulationDescription
                                         settings);
     }
 
+
+
+    namespace
+    {
+      /**
+       * A coarse cell together with the coordinates of its vertices and its
+       * owner, as exchanged between the processes in
+       * create_description_from_distributed_coarse_mesh().
+       */
+      template <int dim, int spacedim>
+      struct DistributedCoarseCell
+      {
+        /**
+         * Serialization function for packing and unpacking the content of this
+         * class.
+         */
+        template <class Archive>
+        void
+        serialize(Archive &ar, const unsigned int /*version*/)
+        {
+          ar &key;
+          ar &id;
+          ar &owner;
+          ar &cell_data;
+          ar &vertices;
+        }
+
+        /**
+         * Return whether this cell comes before @p other along the
+         * space-filling curve. Cells with the same key are sorted by their
+         * id to make the order unique.
+         */
+        bool
+        operator<(const DistributedCoarseCell<dim, spacedim> &other) const
+        {
+          return std::tie(key, id) < std::tie(other.key, other.id);
+        }
+
+        /**
+         * The position of the cell center along the space-filling curve.
+         */
+        std::uint64_t key;
+
+        /**
+         * The index of the cell in the input before the cells are sent to
+         * their owners, and the coarse-cell id afterwards.
+         */
+        types::coarse_cell_id id;
+
+        /**
+         * The rank of the process owning the cell.
+         */
+        unsigned int owner;
+
+        /**
+         * The cell with global vertex indices.
+         */
+        dealii::CellData<dim> cell_data;
+
+        /**
+         * The coordinates of the vertices of the cell.
+         */
+        std::vector<Point<spacedim>> vertices;
+      };
+    } // namespace
+
+
+
+    template <int dim, int spacedim>
+    Description<dim, spacedim>
+    create_description_from_distributed_coarse_mesh(
+      const std::vector<Point<spacedim>>       &local_vertices,
+      const std::vector<dealii::CellData<dim>> &local_cells,
+      const MPI_Comm                            comm,
+      const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing,
+      const TriangulationDescription::Settings                   settings)
+    {
+      const unsigned int my_rank =
+        dealii::Utilities::MPI::this_mpi_process(comm);
+      const unsigned int n_ranks =
+        dealii::Utilities::MPI::n_mpi_processes(comm);
+
+      // 1) determine which process holds which vertices of the input, and
+      //    the global indices of the local cells
+      const std::vector<types::global_vertex_index> n_vertices_per_rank =
+        dealii::Utilities::MPI::all_gather(
+          comm, static_cast<types::global_vertex_index>(local_vertices.size()));
+      std::vector<types::global_vertex_index> vertex_offsets(n_ranks + 1, 0);
+      for (unsigned int r = 0; r < n_ranks; ++r)
+        vertex_offsets[r + 1] = vertex_offsets[r] + n_vertices_per_rank[r];
+
+      const auto vertex_holder = [&vertex_offsets](const unsigned int vertex) {
+        AssertIndexRange(vertex, vertex_offsets.back());
+        return static_cast<unsigned int>(
+          std::upper_bound(vertex_offsets.begin(), vertex_offsets.end(), vertex) -
+          vertex_offsets.begin() - 1);
+      };
+
+      const types::coarse_cell_id first_local_cell =
+        dealii::Utilities::MPI::partial_and_total_sum(
+          static_cast<types::coarse_cell_id>(local_cells.size()), comm)
+          .first;
+
+      // 2) get the coordinates of the vertices of the local cells from the
+      //    processes holding them
+      std::map<unsigned int, std::vector<unsigned int>> requested_vertices;
+      for (const auto &cell : local_cells)
+        for (const unsigned int v : cell.vertices)
+          requested_vertices[vertex_holder(v)].push_back(v);
+      for (auto &[rank, vertices] : requested_vertices)
+        {
+          std::sort(vertices.begin(), vertices.end());
+          vertices.erase(std::unique(vertices.begin(), vertices.end()),
+                         vertices.end());
+        }
+
+      std::map<unsigned int, std::vector<Point<spacedim>>> vertex_answers;
+      for (const auto &[rank, vertices] :
+           dealii::Utilities::MPI::some_to_some(comm, requested_vertices))
+        {
+          auto &points = vertex_answers[rank];
+          points.reserve(vertices.size());
+          for (const unsigned int v : vertices)
+            points.push_back(local_vertices[v - vertex_offsets[my_rank]]);
+        }
+      const auto received_points =
+        dealii::Utilities::MPI::some_to_some(comm, vertex_answers);
+
+      std::map<unsigned int, Point<spacedim>> vertex_coordinates;
+      for (const auto &[rank, vertices] : requested_vertices)
+        {
+          const auto &points = received_points.at(rank);
+          AssertDimension(points.size(), vertices.size());
+          for (unsigned int i = 0; i < vertices.size(); ++i)
+            vertex_coordinates.emplace(vertices[i], points[i]);
+        }
+      requested_vertices.clear();
+
+      // 3) compute the position of the cell centers along a Hilbert curve
+      //    through the bounding box of the whole mesh
+      std::vector<DistributedCoarseCell<dim, spacedim>> cells(
+        local_cells.size());
+      std::vector<Point<spacedim>> centers(local_cells.size());
+      for (unsigned int i = 0; i < local_cells.size(); ++i)
+        {
+          cells[i].id        = first_local_cell + i;
+          cells[i].cell_data = local_cells[i];
+          for (const unsigned int v : local_cells[i].vertices)
+            {
+              cells[i].vertices.push_back(vertex_coordinates[v]);
+              centers[i] += cells[i].vertices.back();
+            }
+          centers[i] /= local_cells[i].vertices.size();
+        }
+      vertex_coordinates.clear();
+
+      // the minimum of the lower corner and of the negative upper corner
+      std::vector<double> bounds(2 * spacedim,
+                                 std::numeric_limits<double>::max());
+      for (const auto &center : centers)
+        for (unsigned int d = 0; d < spacedim; ++d)
+          {
+            bounds[d]            = std::min(bounds[d], center[d]);
+            bounds[spacedim + d] = std::min(bounds[spacedim + d], -center[d]);
+          }
+      dealii::Utilities::MPI::min(bounds, comm, bounds);
+
+      const int bits_per_dim = 63 / spacedim;
+      const std::uint64_t max_int_coordinate =
+        (std::uint64_t(1) << bits_per_dim) - 1;
+      std::vector<std::array<std::uint64_t, spacedim>> int_centers(
+        centers.size());
+      for (unsigned int i = 0; i < centers.size(); ++i)
+        for (unsigned int d = 0; d < spacedim; ++d)
+          {
+            const double extent = -bounds[spacedim + d] - bounds[d];
+            if (extent > 0.)
+              int_centers[i][d] = std::min(
+                static_cast<std::uint64_t>((centers[i][d] - bounds[d]) /
+                                           extent *
+                                           std::ldexp(1., bits_per_dim)),
+                max_int_coordinate);
+            else
+              int_centers[i][d] = 0;
+          }
+      centers.clear();
+
+      const auto hilbert_indices =
+        dealii::Utilities::inverse_Hilbert_space_filling_curve<spacedim>(
+          int_centers, bits_per_dim);
+      for (unsigned int i = 0; i < cells.size(); ++i)
+        cells[i].key =
+          dealii::Utilities::pack_integers<spacedim>(hilbert_indices[i],
+                                                     bits_per_dim);
+      std::sort(cells.begin(), cells.end());
+
+      // 4) find the keys that split the curve into pieces with the same
+      //    number of cells by a bisection on all processes at once, based on
+      //    the global number of cells up to the candidate keys
+      const types::coarse_cell_id n_global_cells =
+        dealii::Utilities::MPI::sum(
+          static_cast<types::coarse_cell_id>(cells.size()), comm);
+
+      std::vector<std::uint64_t> splitters(n_ranks - 1, 0);
+      std::vector<std::uint64_t> upper_splitters(
+        n_ranks - 1, std::numeric_limits<std::uint64_t>::max());
+      std::vector<types::coarse_cell_id> n_cells_up_to_candidate(n_ranks - 1);
+      std::vector<std::uint64_t>         candidates(n_ranks - 1);
+      while (splitters != upper_splitters)
+        {
+          for (unsigned int r = 0; r < n_ranks - 1; ++r)
+            {
+              candidates[r] =
+                splitters[r] + (upper_splitters[r] - splitters[r]) / 2;
+              n_cells_up_to_candidate[r] =
+                std::upper_bound(cells.begin(),
+                                 cells.end(),
+                                 candidates[r],
+                                 [](const std::uint64_t key, const auto &cell) {
+                                   return key < cell.key;
+                                 }) -
+                cells.begin();
+            }
+          dealii::Utilities::MPI::sum(n_cells_up_to_candidate,
+                                      comm,
+                                      n_cells_up_to_candidate);
+
+          for (unsigned int r = 0; r < n_ranks - 1; ++r)
+            if (n_cells_up_to_candidate[r] >=
+                n_global_cells * (r + 1) / n_ranks)
+              upper_splitters[r] = candidates[r];
+            else
+              splitters[r] = candidates[r] + 1;
+        }
+
+      // 5) send the cells to their owners and number them along the curve
+      std::map<unsigned int, std::vector<DistributedCoarseCell<dim, spacedim>>>
+        cells_to_send;
+      for (auto &cell : cells)
+        {
+          cell.owner =
+            std::lower_bound(splitters.begin(), splitters.end(), cell.key) -
+            splitters.begin();
+          cells_to_send[cell.owner].push_back(std::move(cell));
+        }
+      cells.clear();
+
+      std::vector<DistributedCoarseCell<dim, spacedim>> owned_cells;
+      for (auto &[rank, received_cells] :
+           dealii::Utilities::MPI::some_to_some(comm, cells_to_send))
+        owned_cells.insert(owned_cells.end(),
+                           std::make_move_iterator(received_cells.begin()),
+                           std::make_move_iterator(received_cells.end()));
+      cells_to_send.clear();
+      std::sort(owned_cells.begin(), owned_cells.end());
+
+      const types::coarse_cell_id first_owned_cell =
+        dealii::Utilities::MPI::partial_and_total_sum(
+          static_cast<types::coarse_cell_id>(owned_cells.size()), comm)
+          .first;
+      for (unsigned int i = 0; i < owned_cells.size(); ++i)
+        owned_cells[i].id = first_owned_cell + i;
+
+      // 6) find the processes that own cells at the vertices of the locally
+      //    owned cells, using the processes holding the vertices in the
+      //    input as a directory
+      std::map<unsigned int, std::vector<unsigned int>> vertices_of_owned_cells;
+      for (const auto &cell : owned_cells)
+        for (const unsigned int v : cell.cell_data.vertices)
+          vertices_of_owned_cells[vertex_holder(v)].push_back(v);
+      for (auto &[rank, vertices] : vertices_of_owned_cells)
+        {
+          std::sort(vertices.begin(), vertices.end());
+          vertices.erase(std::unique(vertices.begin(), vertices.end()),
+                         vertices.end());
+        }
+
+      std::map<unsigned int, std::vector<unsigned int>> owners_of_vertex;
+      for (const auto &[rank, vertices] :
+           dealii::Utilities::MPI::some_to_some(comm, vertices_of_owned_cells))
+        for (const unsigned int v : vertices)
+          owners_of_vertex[v].push_back(rank);
+      vertices_of_owned_cells.clear();
+
+      std::map<unsigned int, std::vector<std::pair<unsigned int, unsigned int>>>
+        shared_vertices;
+      for (const auto &[vertex, ranks] : owners_of_vertex)
+        for (const unsigned int rank : ranks)
+          for (const unsigned int other_rank : ranks)
+            if (rank != other_rank)
+              shared_vertices[rank].emplace_back(vertex, other_rank);
+      owners_of_vertex.clear();
+
+      std::map<unsigned int, std::vector<unsigned int>> other_owners_of_vertex;
+      for (const auto &[rank, vertices_and_ranks] :
+           dealii::Utilities::MPI::some_to_some(comm, shared_vertices))
+        for (const auto &[vertex, other_rank] : vertices_and_ranks)
+          other_owners_of_vertex[vertex].push_back(other_rank);
+      shared_vertices.clear();
+
+      // 7) send the locally owned cells at the boundary of the partition to
+      //    the processes owning a cell that shares a vertex with them, where
+      //    they become ghost cells
+      std::vector<unsigned int> ghost_receivers;
+      for (const auto &cell : owned_cells)
+        {
+          ghost_receivers.clear();
+          for (const unsigned int v : cell.cell_data.vertices)
+            {
+              const auto other_owners = other_owners_of_vertex.find(v);
+              if (other_owners != other_owners_of_vertex.end())
+                ghost_receivers.insert(ghost_receivers.end(),
+                                       other_owners->second.begin(),
+                                       other_owners->second.end());
+            }
+          std::sort(ghost_receivers.begin(), ghost_receivers.end());
+          ghost_receivers.erase(std::unique(ghost_receivers.begin(),
+                                            ghost_receivers.end()),
+                                ghost_receivers.end());
+          for (const unsigned int rank : ghost_receivers)
+            cells_to_send[rank].push_back(cell);
+        }
+      other_owners_of_vertex.clear();
+
+      std::vector<DistributedCoarseCell<dim, spacedim>> relevant_cells =
+        std::move(owned_cells);
+      for (auto &[rank, received_cells] :
+           dealii::Utilities::MPI::some_to_some(comm, cells_to_send))
+        relevant_cells.insert(relevant_cells.end(),
+                              std::make_move_iterator(received_cells.begin()),
+                              std::make_move_iterator(received_cells.end()));
+      cells_to_send.clear();
+      std::sort(relevant_cells.begin(),
+                relevant_cells.end(),
+                [](const auto &a, const auto &b) { return a.id < b.id; });
+
+      // 8) set up the description of the locally relevant cells with a local
+      //    numbering of the vertices
+      Description<dim, spacedim> description;
+      description.comm     = comm;
+      description.settings = settings;
+      description.smoothing =
+        (settings &
+         TriangulationDescription::Settings::construct_multigrid_hierarchy) ?
+          static_cast<
+            typename dealii::Triangulation<dim, spacedim>::MeshSmoothing>(
+            smoothing |
+            Triangulation<dim, spacedim>::limit_level_difference_at_vertices) :
+          smoothing;
+      description.cell_infos.resize(1);
+
+      std::map<unsigned int, unsigned int> local_vertex_indices;
+      for (const auto &cell : relevant_cells)
+        {
+          dealii::CellData<dim> cell_data = cell.cell_data;
+          for (unsigned int v = 0; v < cell_data.vertices.size(); ++v)
+            {
+              const auto [entry, is_new] = local_vertex_indices.emplace(
+                cell_data.vertices[v],
+                description.coarse_cell_vertices.size());
+              if (is_new)
+                description.coarse_cell_vertices.push_back(cell.vertices[v]);
+              cell_data.vertices[v] = entry->second;
+            }
+          description.coarse_cells.push_back(cell_data);
+          description.coarse_cell_index_to_coarse_cell_id.push_back(cell.id);
+
+          CellData<dim> cell_info;
+          cell_info.id = CellId(cell.id, {}).template to_binary<dim>();
+          cell_info.subdomain_id       = cell.owner;
+          cell_info.level_subdomain_id = cell.owner;
+          cell_info.manifold_id        = cell_data.manifold_id;
+          description.cell_infos[0].push_back(cell_info);
+        }
+
+      return description;
+    }
+
   } // namespace Utilities
 } // namespace TriangulationDescription
 
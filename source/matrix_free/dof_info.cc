@@ -26,6 +26,8 @@
 #include <deal.II/matrix_free/vector_data_exchange.h>
 
 #include <iostream>
+#include <limits>
+#include <map>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -65,6 +67,9 @@ namespace internal
       row_starts_plain_indices.clear();
       plain_dof_indices.clear();
       dof_indices_interleaved.clear();
+      dof_indices_patterns.clear();
+      dof_indices_deltas.clear();
+      dof_indices_pattern_offsets.clear();
       for (unsigned int i = 0; i < 3; ++i)
         {
           index_storage_variants[i].clear();
@@ -897,6 +902,138 @@ namespace internal
 
 
 
+    void
+    DoFInfo::compute_cell_index_patterns()
+    {
+      const bool         have_hp      = dofs_per_cell.size() > 1;
+      const unsigned int n_components = start_components.back();
+
+      std::vector<IndexStorageVariants> &variants =
+        index_storage_variants[dof_access_cell];
+
+      dof_indices_patterns.clear();
+      dof_indices_deltas.clear();
+      dof_indices_pattern_offsets.clear();
+      dof_indices_pattern_offsets.resize(variants.size(),
+                                         numbers::invalid_unsigned_int);
+
+      const auto clear_compression = [&]() {
+        std::vector<unsigned int>().swap(dof_indices_patterns);
+        std::vector<short>().swap(dof_indices_deltas);
+        std::vector<unsigned int>().swap(dof_indices_pattern_offsets);
+      };
+
+      // Step 1: find the cell batches where all cells share the same offsets
+      // of the indices relative to the first index on the respective cell,
+      // and collect the unique patterns. For all other batches, store the
+      // offsets of each cell as 16 bit integers, and give up if they do not
+      // fit, because the interleaved indices would need to be kept around
+      std::map<std::vector<unsigned int>, unsigned int> unique_patterns;
+      std::vector<unsigned int>                         pattern;
+      std::vector<IndexStorageVariants> new_variants(variants.size());
+      for (unsigned int i = 0; i < variants.size(); ++i)
+        if (variants[i] == IndexStorageVariants::interleaved)
+          {
+            AssertDimension(n_vectorization_lanes_filled[dof_access_cell][i],
+                            vectorization_length);
+            const unsigned int ndofs =
+              dofs_per_cell[have_hp ? cell_active_fe_index[i] : 0];
+            const unsigned int *dof_indices =
+              this->dof_indices.data() +
+              row_starts[i * vectorization_length * n_components].first;
+
+            // the subtraction of unsigned integers might wrap around, which
+            // is fine because the decoding adds the same numbers again
+            pattern.resize(ndofs);
+            for (unsigned int k = 0; k < ndofs; ++k)
+              pattern[k] = dof_indices[k] - dof_indices[0];
+
+            bool same_pattern = true;
+            for (unsigned int j = 1; j < vectorization_length && same_pattern;
+                 ++j)
+              for (unsigned int k = 0; k < ndofs; ++k)
+                if (dof_indices[j * ndofs + k] - dof_indices[j * ndofs] !=
+                    pattern[k])
+                  {
+                    same_pattern = false;
+                    break;
+                  }
+
+            if (same_pattern)
+              {
+                const auto entry =
+                  unique_patterns.emplace(pattern,
+                                          dof_indices_patterns.size());
+                if (entry.second)
+                  dof_indices_patterns.insert(dof_indices_patterns.end(),
+                                              pattern.begin(),
+                                              pattern.end());
+                dof_indices_pattern_offsets[i] = entry.first->second;
+                new_variants[i] = IndexStorageVariants::interleaved_pattern;
+              }
+            else
+              {
+                dof_indices_pattern_offsets[i] = dof_indices_deltas.size();
+                for (unsigned int k = 0; k < ndofs; ++k)
+                  for (unsigned int j = 0; j < vectorization_length; ++j)
+                    {
+                      const long long delta =
+                        static_cast<long long>(dof_indices[j * ndofs + k]) -
+                        static_cast<long long>(dof_indices[j * ndofs]);
+                      if (delta < std::numeric_limits<short>::min() ||
+                          delta > std::numeric_limits<short>::max())
+                        {
+                          clear_compression();
+                          return;
+                        }
+                      dof_indices_deltas.push_back(static_cast<short>(delta));
+                    }
+                new_variants[i] = IndexStorageVariants::interleaved_delta;
+              }
+          }
+
+      // Step 2: only use the compression if the new arrays are smaller than
+      // the interleaved indices they replace
+      if (unique_patterns.empty() && dof_indices_deltas.empty())
+        {
+          clear_compression();
+          return;
+        }
+      const std::size_t compressed_size =
+        dof_indices_patterns.size() * sizeof(unsigned int) +
+        dof_indices_deltas.size() * sizeof(short) +
+        dof_indices_pattern_offsets.size() * sizeof(unsigned int);
+      if (compressed_size >=
+          dof_indices_interleaved.size() * sizeof(unsigned int))
+        {
+          clear_compression();
+          return;
+        }
+
+      // Step 3: switch the storage variant, save the first index of each
+      // cell, and release the interleaved indices
+      for (unsigned int i = 0; i < variants.size(); ++i)
+        if (variants[i] == IndexStorageVariants::interleaved)
+          {
+            const unsigned int ndofs =
+              dofs_per_cell[have_hp ? cell_active_fe_index[i] : 0];
+            const unsigned int *dof_indices =
+              this->dof_indices.data() +
+              row_starts[i * vectorization_length * n_components].first;
+            for (unsigned int j = 0; j < vectorization_length; ++j)
+              dof_indices_contiguous[dof_access_cell]
+                                    [i * vectorization_length + j] =
+                                      dof_indices[j * ndofs];
+            variants[i] = new_variants[i];
+          }
+
+      dof_indices_patterns.shrink_to_fit();
+      dof_indices_deltas.shrink_to_fit();
+      std::vector<unsigned int>().swap(dof_indices_interleaved);
+    }
+
+
+
     void
     DoFInfo::compute_tight_partitioners(
       const Table<2, ShapeInfo<double>>        &shape_info,
@@ -1539,6 +1676,10 @@ namespace internal
         (row_starts.capacity() * sizeof(std::pair<unsigned int, unsigned int>));
       memory += MemoryConsumption::memory_consumption(dof_indices);
       memory += MemoryConsumption::memory_consumption(dof_indices_interleaved);
+      memory += MemoryConsumption::memory_consumption(dof_indices_patterns);
+      memory += MemoryConsumption::memory_consumption(dof_indices_deltas);
+      memory +=
+        MemoryConsumption::memory_consumption(dof_indices_pattern_offsets);
       memory += MemoryConsumption::memory_consumption(dof_indices_contiguous);
       memory +=
         MemoryConsumption::memory_consumption(dof_indices_contiguous_sm);
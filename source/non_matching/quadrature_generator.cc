@@ -909,6 +909,25 @@ namespace NonMatching
 
 
 
+      template <int dim, int spacedim>
+      void
+      QGeneratorBase<dim, spacedim>::set_quadratures(
+        const QPartitioning<dim> &quadratures)
+      {
+        q_partitioning = quadratures;
+      }
+
+
+
+      template <int dim, int spacedim>
+      unsigned int
+      QGeneratorBase<dim, spacedim>::get_1D_quadrature_index() const
+      {
+        return q_index;
+      }
+
+
+
       template <int dim, int spacedim>
       void
       QGenerator<dim, spacedim>::generate(
@@ -1372,6 +1391,19 @@ namespace NonMatching
         unsigned int
         n_subdivisions() const override;
 
+        /**
+         * @copydoc CellWiseFunction::get_fe()
+         */
+        const FiniteElement<dim> &
+        get_fe() const override;
+
+        /**
+         * @copydoc CellWiseFunction::get_local_dof_values()
+         */
+        void
+        get_local_dof_values(
+          std::vector<double> &local_dof_values) const override;
+
         /**
          * @copydoc Function::value()
          *
@@ -1604,6 +1636,28 @@ namespace NonMatching
 
 
 
+      template <int dim, typename Number>
+      const FiniteElement<dim> &
+      RefSpaceFEFieldFunction<dim, Number>::get_fe() const
+      {
+        Assert(cell_is_set(), ExcCellNotSet());
+        return *element;
+      }
+
+
+
+      template <int dim, typename Number>
+      void
+      RefSpaceFEFieldFunction<dim, Number>::get_local_dof_values(
+        std::vector<double> &local_dof_values) const
+      {
+        Assert(cell_is_set(), ExcCellNotSet());
+        local_dof_values.assign(this->local_dof_values.begin(),
+                                this->local_dof_values.end());
+      }
+
+
+
       template <int dim, typename Number>
       bool
       RefSpaceFEFieldFunction<dim, Number>::cell_is_set() const
@@ -2128,6 +2182,7 @@ namespace NonMatching
         std::make_unique<internal::DiscreteQuadratureGeneratorImplementation::
                            RefSpaceFEFieldFunction<dim, Number>>(dof_handler,
                                                                  level_set))
+    , cache_tolerance(-1.)
   {}
 
 
@@ -2199,11 +2254,72 @@ namespace NonMatching
              ExcReferenceCellNotHypercube());
 
     reference_space_level_set->set_active_cell(cell);
+
+    // check whether we have created quadratures for (almost) the same level
+    // set function on this cell before
+    CachedQuadratures *cache_entry = nullptr;
+    if (cache_tolerance >= 0.)
+      {
+        if (cell->active_cell_index() >= cache.size())
+          cache.resize(cell->get_triangulation().n_active_cells());
+        cache_entry = &cache[cell->active_cell_index()];
+
+        reference_space_level_set->get_local_dof_values(level_set_values);
+        const FiniteElement<dim> *fe = &reference_space_level_set->get_fe();
+        const unsigned int q_index = this->q_generator.get_1D_quadrature_index();
+
+        bool can_reuse = cache_entry->fe == fe &&
+                         cache_entry->q_index == q_index &&
+                         cache_entry->level_set_values.size() ==
+                           level_set_values.size();
+        for (unsigned int i = 0; can_reuse && i < level_set_values.size(); ++i)
+          can_reuse = std::abs(level_set_values[i] -
+                               cache_entry->level_set_values[i]) <=
+                      cache_tolerance;
+
+        if (can_reuse)
+          {
+            this->q_generator.set_quadratures(cache_entry->quadratures);
+            return;
+          }
+
+        // invalidate the entry until the new quadratures have been created
+        cache_entry->fe = nullptr;
+      }
+
     const BoundingBox<dim> unit_box = create_unit_bounding_box<dim>();
     if (reference_space_level_set->is_fe_q_iso_q1())
       generate_fe_q_iso_q1(unit_box);
     else
       QuadratureGenerator<dim>::generate(*reference_space_level_set, unit_box);
+
+    if (cache_entry != nullptr)
+      {
+        cache_entry->fe      = &reference_space_level_set->get_fe();
+        cache_entry->q_index = this->q_generator.get_1D_quadrature_index();
+        cache_entry->level_set_values.swap(level_set_values);
+        cache_entry->quadratures = this->q_generator.get_quadratures();
+      }
+  }
+
+
+
+  template <int dim>
+  void
+  DiscreteQuadratureGenerator<dim>::set_cache_tolerance(const double tolerance)
+  {
+    cache_tolerance = tolerance;
+    if (cache_tolerance < 0.)
+      clear_cache();
+  }
+
+
+
+  template <int dim>
+  void
+  DiscreteQuadratureGenerator<dim>::clear_cache()
+  {
+    cache.clear();
   }
 
 
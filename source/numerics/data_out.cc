@@ -29,6 +29,8 @@
 
 #include <deal.II/numerics/data_out.h>
 
+#include <functional>
+#include <memory>
 #include <sstream>
 
 DEAL_II_NAMESPACE_OPEN
@@ -1323,6 +1325,88 @@ DataOut<dim, spacedim>::set_cell_selection(
 
 
 
+template <int dim, int spacedim>
+void
+DataOut<dim, spacedim>::set_cell_selection(
+  const BoundingBox<spacedim> &region_of_interest,
+  const unsigned int           max_level)
+{
+  // For every cell on level max_level, we store whether all of its active
+  // descendants are locally owned, in which case the cell is written instead
+  // of its descendants. These flags are computed whenever a new loop over
+  // the cells starts, i.e., in the first-cell function.
+  const auto coarse_cell_is_owned = std::make_shared<std::vector<bool>>();
+
+  const auto all_descendants_owned = [](const cell_iterator &cell) {
+    const std::function<bool(const cell_iterator &)> check =
+      [&check](const cell_iterator &cell) {
+        if (cell->is_active())
+          return cell->is_locally_owned();
+        for (const auto &child : cell->child_iterators())
+          if (!check(child))
+            return false;
+        return true;
+      };
+    return check(cell);
+  };
+
+  const auto is_selected = [region_of_interest,
+                            max_level,
+                            coarse_cell_is_owned](const cell_iterator &cell) {
+    if (!region_of_interest.has_overlap_with(cell->bounding_box()))
+      return false;
+
+    if (static_cast<unsigned int>(cell->level()) < max_level)
+      return cell->is_active() && cell->is_locally_owned();
+    else if (static_cast<unsigned int>(cell->level()) == max_level)
+      return static_cast<bool>((*coarse_cell_is_owned)[cell->index()]);
+    else
+      {
+        if (!cell->is_active() || !cell->is_locally_owned())
+          return false;
+
+        // only write the cell if its ancestor on max_level is not written
+        cell_iterator ancestor = cell;
+        while (static_cast<unsigned int>(ancestor->level()) > max_level)
+          ancestor = ancestor->parent();
+        return !(*coarse_cell_is_owned)[ancestor->index()];
+      }
+  };
+
+  const auto next_cell =
+    [is_selected](const Triangulation<dim, spacedim> &triangulation,
+                  const cell_iterator                &old_cell) {
+      cell_iterator cell = old_cell;
+      ++cell;
+      while (cell != triangulation.end() && !is_selected(cell))
+        ++cell;
+      return cell;
+    };
+
+  const auto first_cell =
+    [max_level, coarse_cell_is_owned, all_descendants_owned, is_selected](
+      const Triangulation<dim, spacedim> &triangulation) {
+      coarse_cell_is_owned->clear();
+      if (max_level < triangulation.n_levels())
+        {
+          coarse_cell_is_owned->resize(triangulation.n_raw_cells(max_level),
+                                       false);
+          for (const auto &cell : triangulation.cell_iterators_on_level(max_level))
+            (*coarse_cell_is_owned)[cell->index()] =
+              all_descendants_owned(cell);
+        }
+
+      cell_iterator cell = triangulation.begin();
+      while (cell != triangulation.end() && !is_selected(cell))
+        ++cell;
+      return cell;
+    };
+
+  set_cell_selection(first_cell, next_cell);
+}
+
+
+
 template <int dim, int spacedim>
 std::pair<typename DataOut<dim, spacedim>::FirstCellFunctionType,
           typename DataOut<dim, spacedim>::NextCellFunctionType>
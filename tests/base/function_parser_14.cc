@@ -0,0 +1,148 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check the compiled evaluation of FunctionParser and TensorFunctionParser
+// by comparing all evaluation functions to the results of muParser, which
+// we force by adding a call to rand() that the compiled evaluation does not
+// support. The last expression checks that constants with the values -0 and
+// +0 are kept apart and that folded constants may be NaN
+
+#include <deal.II/base/function_parser.h>
+#include <deal.II/base/tensor_function_parser.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../tests.h"
+
+
+const std::vector<std::string> expressions = {
+  "sin(2*x)*cos(y)^2 + -x^2 + 2^-y + c*t",
+  "if(x>0.3, x*y, cos (y)) + (x<y ? 1 : 2) + (x<y || y>1) + (x&y) + (x|0)",
+  "min(x,y,0.5) + max(x,y) + sum(x,y,t) + avg(x,y,3) + abs(-x) + sqrt(y)",
+  "atan2(x,y) + pow(x,y) + log(y+1) + ln(2) + log2(x+1) + log10(y+1)",
+  "int(x*3) + ceil(y*3) + floor(x*5) + sign(x-0.5) + rint(y*3) + _pi*_e",
+  "1.5e-1 + .25 + 3. + x^3 + (x+y)^2 - (x-y)^2 + cot(x+1) + csc(x+1)",
+  "sec(y) + erfc(x) + asinh(x) + acosh(y+1) + atanh(x/2) + tanh(y)",
+  "sinh(x) + cosh(y) + asin(x/2) + acos(y/3) + atan(x) + tan(y)",
+  "x <= y && y >= x == 1 != 0 + sin(2*x)*cos(y)^2",
+  "atan2(0, -1) + atan2(-0, -1) + x^4 + y^3 + (x > 2 ? sqrt(-1) : x) + "
+  "(x > 2 ? 0/0 : y)"};
+
+
+
+void
+test_function_parser()
+{
+  const std::map<std::string, double> constants = {{"c", 2.5}};
+
+  std::vector<std::string> reference_expressions = expressions;
+  for (std::string &expression : reference_expressions)
+    expression += " + 0*rand()";
+
+  FunctionParser<2> function(expressions.size());
+  FunctionParser<2> reference(expressions.size());
+  function.initialize("x,y,t", expressions, constants, true);
+  reference.initialize("x,y,t", reference_expressions, constants, true);
+  function.set_time(0.3);
+  reference.set_time(0.3);
+
+  // use a number of points that is not a multiple of the SIMD width
+  std::vector<Point<2>> points;
+  for (unsigned int q = 0; q < 13; ++q)
+    points.emplace_back(0.07 * q, 1. - 0.05 * q);
+
+  std::vector<Vector<double>> vector_values(points.size(),
+                                            Vector<double>(expressions.size()));
+  function.vector_value_list(points, vector_values);
+
+  double error = 0;
+  for (unsigned int c = 0; c < expressions.size(); ++c)
+    {
+      std::vector<double> values(points.size());
+      function.value_list(points, values, c);
+
+      for (unsigned int q = 0; q < points.size(); ++q)
+        {
+          const double exact = reference.value(points[q], c);
+          error =
+            std::max(error, std::abs(function.value(points[q], c) - exact));
+          error = std::max(error, std::abs(values[q] - exact));
+          error = std::max(error, std::abs(vector_values[q][c] - exact));
+        }
+
+      Point<2, VectorizedArray<double>> batch;
+      for (unsigned int v = 0; v < VectorizedArray<double>::size(); ++v)
+        for (unsigned int d = 0; d < 2; ++d)
+          batch[d][v] = points[v][d];
+      const VectorizedArray<double> batch_values =
+        function.vectorized_value(batch, c);
+      for (unsigned int v = 0; v < VectorizedArray<double>::size(); ++v)
+        error = std::max(error,
+                         std::abs(batch_values[v] -
+                                  reference.value(points[v], c)));
+    }
+
+  deallog << "FunctionParser: " << (error < 1e-12 ? "OK" : "wrong")
+          << std::endl;
+}
+
+
+
+void
+test_tensor_function_parser()
+{
+  const std::string expression = "x*y + t; sin(x)*sin(x); exp(x-y); x^2 + y^2";
+
+  TensorFunctionParser<2, 2> function;
+  TensorFunctionParser<2, 2> reference;
+  function.initialize("x,y,t", expression, {}, true);
+  reference.initialize("x,y,t", expression + " + 0*rand()", {}, true);
+  function.set_time(0.5);
+  reference.set_time(0.5);
+
+  std::vector<Point<2>> points;
+  for (unsigned int q = 0; q < 5; ++q)
+    points.emplace_back(0.1 * q, 0.3 - 0.2 * q);
+
+  std::vector<Tensor<2, 2>> values(points.size());
+  function.value_list(points, values);
+
+  double error = 0;
+  for (unsigned int q = 0; q < points.size(); ++q)
+    {
+      const Tensor<2, 2> exact = reference.value(points[q]);
+      error = std::max(error, (values[q] - exact).norm());
+      error = std::max(error, (function.value(points[q]) - exact).norm());
+    }
+
+  deallog << "TensorFunctionParser: " << (error < 1e-12 ? "OK" : "wrong")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test_function_parser();
+  test_tensor_function_parser();
+}
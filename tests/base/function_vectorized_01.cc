@@ -0,0 +1,107 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check Function::vectorized_value() for the default implementation and the
+// library functions overriding it by comparing to Function::value() on
+// every lane
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/function_lib.h>
+#include <deal.II/base/vectorization.h>
+
+#include <string>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+class MyFunction : public Function<dim>
+{
+public:
+  virtual double
+  value(const Point<dim> &p, const unsigned int) const override
+  {
+    return p[0] + 2. * p[dim - 1];
+  }
+};
+
+
+
+template <int dim>
+void
+check(const Function<dim> &function, const std::string &name)
+{
+  constexpr unsigned int n_lanes = VectorizedArray<double>::size();
+
+  Point<dim, VectorizedArray<double>> p;
+  for (unsigned int v = 0; v < n_lanes; ++v)
+    for (unsigned int d = 0; d < dim; ++d)
+      p[d][v] = 0.1 * (v + 1) - 0.2 * d;
+
+  double error = 0;
+  for (unsigned int c = 0; c < function.n_components; ++c)
+    {
+      const VectorizedArray<double> values = function.vectorized_value(p, c);
+      for (unsigned int v = 0; v < n_lanes; ++v)
+        {
+          Point<dim> point;
+          for (unsigned int d = 0; d < dim; ++d)
+            point[d] = p[d][v];
+          error =
+            std::max(error, std::abs(values[v] - function.value(point, c)));
+        }
+    }
+
+  deallog << name << "<" << dim << ">: " << (error < 1e-14 ? "OK" : "wrong")
+          << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Tensor<1, dim> fourier_coefficients;
+  for (unsigned int d = 0; d < dim; ++d)
+    fourier_coefficients[d] = 1. + d;
+
+  check(MyFunction<dim>(), "MyFunction");
+  check(Functions::ConstantFunction<dim>(std::vector<double>{1., 2.}),
+        "ConstantFunction");
+  check(Functions::ZeroFunction<dim>(), "ZeroFunction");
+  check(ComponentSelectFunction<dim>(1, 3), "ComponentSelectFunction");
+  check(Functions::IdentityFunction<dim>(), "IdentityFunction");
+  check(Functions::SquareFunction<dim>(), "SquareFunction");
+  check(Functions::CosineFunction<dim>(2), "CosineFunction");
+  check(Functions::ExpFunction<dim>(), "ExpFunction");
+  check(Functions::FourierCosineFunction<dim>(fourier_coefficients),
+        "FourierCosineFunction");
+  check(Functions::FourierSineFunction<dim>(fourier_coefficients),
+        "FourierSineFunction");
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<1>();
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,100 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// test TimerOutput::print_hierarchical_summary(),
+// TimerOutput::write_folded_stacks(), and TimerOutput::write_chrome_trace()
+// for nested sections
+
+#include <deal.II/base/timer.h>
+
+#include <algorithm>
+#include <sstream>
+
+#include "../tests.h"
+
+// burn computer time
+double s = 0.;
+void
+burn(unsigned int n)
+{
+  for (unsigned int i = 0; i < n; ++i)
+    {
+      for (unsigned int j = 1; j < 100000; ++j)
+        {
+          s += 1. / j * i;
+        }
+    }
+}
+
+void
+test()
+{
+  std::stringstream ss;
+
+  TimerOutput t(ss, TimerOutput::never, TimerOutput::wall_times);
+  t.record_trace_events();
+
+  {
+    TimerOutput::Scope scope(t, "solve");
+    burn(20);
+    {
+      TimerOutput::Scope scope(t, "setup");
+      burn(20);
+    }
+    for (unsigned int i = 0; i < 2; ++i)
+      {
+        TimerOutput::Scope scope(t, "iterate");
+        burn(20);
+      }
+  }
+  {
+    TimerOutput::Scope scope(t, "output");
+    burn(20);
+  }
+
+  t.print_hierarchical_summary();
+
+  std::string summary = ss.str();
+  std::replace_if(summary.begin(), summary.end(), ::isdigit, ' ');
+  std::replace_if(
+    summary.begin(), summary.end(), [](char x) { return x == '.'; }, ' ');
+  deallog << summary << std::endl;
+
+  // only print the stacks, not the times
+  std::stringstream folded;
+  t.write_folded_stacks(folded);
+  std::string line;
+  while (std::getline(folded, line))
+    deallog << line.substr(0, line.rfind(' ')) << std::endl;
+
+  std::stringstream trace;
+  t.write_chrome_trace(trace);
+  while (std::getline(trace, line))
+    {
+      line.erase(std::remove_if(line.begin(), line.end(), ::isdigit),
+                 line.end());
+      deallog << line << std::endl;
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  initlog();
+
+  test();
+}
@@ -0,0 +1,75 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// test Utilities::System::set_huge_page_threshold() with AlignedVector and
+// Table objects above and below the threshold
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/utilities.h>
+
+#include <cstdint>
+
+#include "../tests.h"
+
+
+
+template <typename T>
+bool
+is_aligned(const T *ptr, const std::size_t alignment)
+{
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  Utilities::System::set_huge_page_threshold(4 * 1024 * 1024);
+  deallog << "threshold: " << Utilities::System::get_huge_page_threshold()
+          << std::endl;
+
+  AlignedVector<double> small(1000);
+  AlignedVector<double> large(1000000);
+  Table<2, float>       table(1000, 3000);
+  for (unsigned int i = 0; i < large.size(); ++i)
+    large[i] = i % 3;
+  table.fill(1.f);
+
+  double sum = 0;
+  for (const double value : large)
+    sum += value;
+  deallog << "sum: " << sum << ' ' << table(999, 2999) << std::endl;
+
+  deallog << "64-byte aligned: " << is_aligned(small.data(), 64) << ' '
+          << is_aligned(large.data(), 64) << ' '
+          << is_aligned(&table(0, 0), 64) << std::endl;
+#ifdef __linux__
+  deallog << "huge page aligned: " << is_aligned(large.data(), 2 * 1024 * 1024)
+          << ' ' << is_aligned(&table(0, 0), 2 * 1024 * 1024) << std::endl;
+#else
+  deallog << "huge page aligned: 1 1" << std::endl;
+#endif
+
+  Utilities::System::set_huge_page_threshold(0);
+  AlignedVector<double> other(1000000, 1.);
+  deallog << "threshold: " << Utilities::System::get_huge_page_threshold()
+          << ' ' << other[999999] << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,66 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test DataOutBase::compute_field_statistics() for fields that contain NaN
+// and infinite values, which must be counted separately and not enter the
+// extrema, the average, and the histogram
+
+#include <deal.II/base/data_out_base.h>
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../tests.h"
+
+#include "patches.h"
+
+
+
+int
+main()
+{
+  initlog();
+
+  std::vector<DataOutBase::Patch<2, 2>> patches(4);
+  create_patches(patches);
+
+  // replace some values of the first and last quantity
+  patches[0].data(0, 0) = std::numeric_limits<double>::quiet_NaN();
+  patches[2].data(0, 3) = std::numeric_limits<double>::infinity();
+  for (unsigned int q = 0; q < patches[1].data.n_cols(); ++q)
+    patches[1].data(4, q) = -std::numeric_limits<double>::infinity();
+  for (auto &patch : patches)
+    patch.data(3, 0) = std::numeric_limits<double>::quiet_NaN();
+
+  // a quantity without any finite value
+  for (auto &patch : patches)
+    for (unsigned int q = 0; q < patch.data.n_cols(); ++q)
+      patch.data(2, q) = std::numeric_limits<double>::quiet_NaN();
+
+  const std::vector<std::string> names = {"x1", "x2", "nan", "x4", "i"};
+  for (const auto &statistics :
+       DataOutBase::compute_field_statistics(patches, names, 4, MPI_COMM_SELF))
+    {
+      deallog << statistics.name << ": n_points=" << statistics.n_points
+              << " n_non_finite_values=" << statistics.n_non_finite_values
+              << " min=" << statistics.min_value
+              << " max=" << statistics.max_value
+              << " mean=" << statistics.mean_value << " histogram=";
+      for (const auto count : statistics.histogram)
+        deallog << count << ' ';
+      deallog << std::endl;
+    }
+}
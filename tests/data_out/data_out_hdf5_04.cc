@@ -0,0 +1,103 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// test parallel DataOut with HDF5 + xdmf for a time series: the mesh is
+// written once, and the compressed solution of every time step is added as
+// a group to a single solution file
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/numerics/data_out.h>
+
+#include <string>
+#include <vector>
+
+#include "../tests.h"
+
+template <int dim>
+void
+test()
+{
+  parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(1);
+
+  FE_Q<dim> fe(1);
+
+  DoFHandler<dim> dof(tria);
+  dof.distribute_dofs(fe);
+
+  Vector<double> v1(dof.n_dofs());
+
+  std::vector<XDMFEntry> xdmf_entries;
+  for (unsigned int step = 0; step < 2; ++step)
+    {
+      for (unsigned int i = 0; i < v1.size(); ++i)
+        v1(i) = i + step;
+
+      DataOut<dim> data_out;
+      data_out.add_data_vector(dof, v1, "bla");
+      data_out.build_patches(1);
+
+      // use small chunks to get several chunks per dataset
+      DataOutBase::Hdf5Flags flags(
+        DataOutBase::CompressionLevel::best_compression, 4);
+      flags.solution_group = "step_" + std::to_string(step);
+      data_out.set_flags(flags);
+
+      DataOutBase::DataOutFilter data_filter(
+        DataOutBase::DataOutFilterFlags(false, false));
+      data_out.write_filtered_data(data_filter);
+      data_out.write_hdf5_parallel(
+        data_filter, step == 0, "mesh.h5", "solution.h5", MPI_COMM_WORLD);
+
+      xdmf_entries.push_back(data_out.create_xdmf_entry(
+        data_filter, "mesh.h5", "solution.h5", 0.5 * step, MPI_COMM_WORLD));
+      data_out.write_xdmf_file(xdmf_entries, "out.xdmf", MPI_COMM_WORLD);
+
+      deallog << "step " << step << " written" << std::endl;
+    }
+
+  if (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+    {
+      cat_file("out.xdmf");
+
+      // Sadly hdf5 is binary and we can not use hd5dump because it might
+      // not be in the path.
+      std::ifstream f1("mesh.h5");
+      AssertThrow(f1.good(), ExcIO());
+      std::ifstream f2("solution.h5");
+      AssertThrow(f2.good(), ExcIO());
+      deallog << "ok" << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test<2>();
+}
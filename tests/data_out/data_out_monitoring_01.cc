@@ -0,0 +1,98 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test reduced output for monitoring: DataOut::set_cell_selection() with a
+// region of interest and a maximal level, and VtkFlags::significant_bits
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/data_out.h>
+
+#include <sstream>
+#include <string>
+
+#include "../tests.h"
+
+
+
+int
+main()
+{
+  initlog();
+
+  Triangulation<2> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  FE_Q<2>       fe(1);
+  DoFHandler<2> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  Vector<double> u(dof_handler.n_dofs());
+  u = 1. / 3.;
+
+  const BoundingBox<2> region_of_interest(
+    std::make_pair(Point<2>(0., 0.), Point<2>(0.6, 0.4)));
+
+  DataOut<2> data_out;
+  data_out.attach_dof_handler(dof_handler);
+  data_out.add_data_vector(u, "u");
+  data_out.add_data_vector(u, "v");
+
+  // all active cells in the region of interest
+  data_out.set_cell_selection(region_of_interest);
+  data_out.build_patches();
+  deallog << "Active cells: " << data_out.get_patches().size() << " patches"
+          << std::endl;
+
+  // subsampled to level 1
+  data_out.set_cell_selection(region_of_interest, 1);
+  data_out.build_patches();
+  deallog << "Level 1: " << data_out.get_patches().size() << " patches"
+          << std::endl;
+  for (const auto &patch : data_out.get_patches())
+    deallog << "Patch from " << patch.vertices[0] << " to "
+            << patch.vertices[3] << std::endl;
+
+  // write u with 4 significant bits and v with full precision
+  DataOutBase::VtkFlags flags;
+  flags.print_date_and_time = false;
+  flags.compression_level   = DataOutBase::CompressionLevel::plain_text;
+  flags.significant_bits["u"] = 4;
+  data_out.set_flags(flags);
+
+  std::ostringstream vtu;
+  data_out.write_vtu(vtu);
+
+  std::istringstream in(vtu.str());
+  std::string        line;
+  while (std::getline(in, line))
+    if (line.find("Name=\"u\"") != std::string::npos ||
+        line.find("Name=\"v\"") != std::string::npos)
+      {
+        const std::string name = line.substr(line.find("Name=") + 6, 1);
+        std::getline(in, line);
+        deallog << name << ": " << line << std::endl;
+      }
+}
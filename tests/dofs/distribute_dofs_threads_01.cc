@@ -0,0 +1,132 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that the DoF numbering, which is computed in parallel chunks of cells
+// during DoFHandler::distribute_dofs() and renumbered in parallel chunks
+// during DoFHandler::renumber_dofs(), does not depend on the number of
+// threads and numbers the DoFs in the order in which a loop over all cells
+// visits them first. The meshes are large enough to be split into several
+// chunks, and the 3d mesh contains lines and faces in non-standard
+// orientation.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+std::vector<types::global_dof_index>
+get_dof_indices(const DoFHandler<dim> &dof_handler)
+{
+  std::vector<types::global_dof_index> all_indices, local_dof_indices;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      local_dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+      cell->get_dof_indices(local_dof_indices);
+      all_indices.insert(all_indices.end(),
+                         local_dof_indices.begin(),
+                         local_dof_indices.end());
+    }
+  return all_indices;
+}
+
+
+
+template <int dim>
+std::vector<types::global_dof_index>
+distribute_and_renumber(const Triangulation<dim> &tria,
+                        const unsigned int        n_threads)
+{
+  MultithreadInfo::set_thread_limit(n_threads);
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(FE_Q<dim>(3));
+
+  // the DoFs must appear in increasing order when going through the DoF
+  // indices of all cells and skipping the ones seen before
+  const std::vector<types::global_dof_index> indices =
+    get_dof_indices(dof_handler);
+  std::vector<bool>       seen(dof_handler.n_dofs(), false);
+  types::global_dof_index next_index  = 0;
+  bool                    is_cellwise = true;
+  for (const types::global_dof_index i : indices)
+    if (seen[i] == false)
+      {
+        seen[i] = true;
+        if (i != next_index)
+          is_cellwise = false;
+        ++next_index;
+      }
+
+  deallog << "n_threads=" << n_threads << " n_dofs=" << dof_handler.n_dofs()
+          << " numbered cell by cell: "
+          << (is_cellwise && next_index == dof_handler.n_dofs() ? "yes" : "no")
+          << std::endl;
+
+  std::vector<types::global_dof_index> new_numbers(dof_handler.n_dofs());
+  for (types::global_dof_index i = 0; i < dof_handler.n_dofs(); ++i)
+    new_numbers[i] = dof_handler.n_dofs() - 1 - i;
+  dof_handler.renumber_dofs(new_numbers);
+
+  return get_dof_indices(dof_handler);
+}
+
+
+
+template <int dim>
+void
+test(const Triangulation<dim> &tria)
+{
+  deallog << "dim=" << dim << " n_cells=" << tria.n_active_cells()
+          << std::endl;
+
+  const std::vector<types::global_dof_index> serial =
+    distribute_and_renumber(tria, 1);
+  const std::vector<types::global_dof_index> threaded =
+    distribute_and_renumber(tria, 4);
+  AssertThrow(serial == threaded, ExcInternalError());
+
+  deallog << "OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  {
+    Triangulation<2> tria;
+    GridGenerator::hyper_cube(tria);
+    tria.refine_global(6);
+    test(tria);
+  }
+  {
+    Triangulation<3> tria;
+    GridGenerator::hyper_ball(tria);
+    tria.refine_global(3);
+    test(tria);
+  }
+
+  MultithreadInfo::set_thread_limit(testing_max_num_threads());
+}
@@ -0,0 +1,116 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Create a fully distributed triangulation from a coarse mesh of which each
+// process only holds a slice of the vertices and cells, partitioned along a
+// Hilbert curve by
+// TriangulationDescription::Utilities::create_description_from_distributed_coarse_mesh().
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const unsigned int n_subdivisions, const MPI_Comm comm)
+{
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
+
+  // set up the mesh on every process only to have some input; each process
+  // then only passes on a slice of the vertices and cells, with the cells in
+  // reverse order
+  Triangulation<dim> serial_tria;
+  GridGenerator::subdivided_hyper_cube(serial_tria, n_subdivisions);
+
+  const unsigned int n_vertices = serial_tria.n_vertices();
+  std::vector<Point<dim>> local_vertices(
+    serial_tria.get_vertices().begin() + n_vertices * my_rank / n_ranks,
+    serial_tria.get_vertices().begin() + n_vertices * (my_rank + 1) / n_ranks);
+
+  std::vector<CellData<dim>> all_cells;
+  for (const auto &cell : serial_tria.active_cell_iterators())
+    {
+      CellData<dim> cell_data(cell->n_vertices());
+      for (const unsigned int v : cell->vertex_indices())
+        cell_data.vertices[v] = cell->vertex_index(v);
+      cell_data.material_id = cell->active_cell_index() % 3;
+      all_cells.push_back(cell_data);
+    }
+  std::reverse(all_cells.begin(), all_cells.end());
+
+  const unsigned int         n_cells = all_cells.size();
+  std::vector<CellData<dim>> local_cells(
+    all_cells.begin() + n_cells * my_rank / n_ranks,
+    all_cells.begin() + n_cells * (my_rank + 1) / n_ranks);
+
+  const auto description = TriangulationDescription::Utilities::
+    create_description_from_distributed_coarse_mesh(local_vertices,
+                                                    local_cells,
+                                                    comm);
+
+  parallel::fullydistributed::Triangulation<dim> tria(comm);
+  tria.create_triangulation(description);
+
+  double       volume       = 0;
+  unsigned int material_ids = 0;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      {
+        volume += cell->measure();
+        material_ids += cell->material_id();
+      }
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(FE_Q<dim>(1));
+
+  deallog << "n_global_active_cells: " << tria.n_global_active_cells()
+          << std::endl;
+  deallog << "n_locally_owned_active_cells: "
+          << tria.n_locally_owned_active_cells() << std::endl;
+  deallog << "volume: " << Utilities::MPI::sum(volume, comm) << std::endl;
+  deallog << "sum of material ids: "
+          << Utilities::MPI::sum(material_ids, comm) << std::endl;
+  deallog << "n_dofs: " << dof_handler.n_dofs() << std::endl;
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  const MPI_Comm comm = MPI_COMM_WORLD;
+
+  deallog.push("2d");
+  test<2>(8, comm);
+  deallog.pop();
+
+  deallog.push("3d");
+  test<3>(4, comm);
+  deallog.pop();
+}
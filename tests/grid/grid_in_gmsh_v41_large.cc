@@ -0,0 +1,100 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Read a mesh in the GMSH-4.1 format with entity blocks that are large
+// enough to be converted in several parallel chunks, and with a comment
+// section in the middle of the file.
+
+#include <deal.II/grid/grid_in.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include "../tests.h"
+
+
+void
+test(const unsigned int n)
+{
+  // a unit square with n x n quadrilaterals on the surface with physical
+  // tag 3 and lines along the bottom on the curve with physical tag 7
+  const auto node = [n](const unsigned int i, const unsigned int j) {
+    return 1 + i + j * (n + 1);
+  };
+  const unsigned int n_nodes = (n + 1) * (n + 1);
+
+  std::ostringstream msh;
+  msh << "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n";
+  msh << "$Entities\n0 1 1 0\n";
+  msh << "1 0 0 0 1 0 0 1 7 0\n";
+  msh << "1 0 0 0 1 1 0 1 3 0\n";
+  msh << "$EndEntities\n";
+  msh << "$Comments\nsome text that is not part of the mesh\n$EndComments\n";
+
+  msh << "$Nodes\n1 " << n_nodes << " 1 " << n_nodes << '\n';
+  msh << "2 1 0 " << n_nodes << '\n';
+  for (unsigned int i = 1; i <= n_nodes; ++i)
+    msh << i << '\n';
+  for (unsigned int j = 0; j <= n; ++j)
+    for (unsigned int i = 0; i <= n; ++i)
+      msh << 1. * i / n << ' ' << 1. * j / n << " 0\n";
+  msh << "$EndNodes\n";
+
+  msh << "$Elements\n2 " << n + n * n << " 1 " << n + n * n << '\n';
+  msh << "1 1 1 " << n << '\n';
+  for (unsigned int i = 0; i < n; ++i)
+    msh << 1 + i << ' ' << node(i, 0) << ' ' << node(i + 1, 0) << '\n';
+  msh << "2 1 3 " << n * n << '\n';
+  for (unsigned int j = 0; j < n; ++j)
+    for (unsigned int i = 0; i < n; ++i)
+      msh << 1 + n + i + j * n << ' ' << node(i, j) << ' ' << node(i + 1, j)
+          << ' ' << node(i + 1, j + 1) << ' ' << node(i, j + 1) << '\n';
+  msh << "$EndElements\n";
+
+  Triangulation<2> tria;
+  GridIn<2>        grid_in;
+  grid_in.attach_triangulation(tria);
+  std::istringstream in(msh.str());
+  grid_in.read_msh(in);
+
+  double       area             = 0;
+  unsigned int n_boundary_faces = 0;
+  for (const auto &cell : tria.active_cell_iterators())
+    {
+      AssertThrow(cell->material_id() == 3, ExcInternalError());
+      area += cell->measure();
+      for (const auto &face : cell->face_iterators())
+        if (face->at_boundary() && face->boundary_id() == 7)
+          {
+            AssertThrow(std::abs(face->center()[1]) < 1e-12,
+                        ExcInternalError());
+            ++n_boundary_faces;
+          }
+    }
+
+  deallog << "n_active_cells: " << tria.n_active_cells() << std::endl;
+  deallog << "n_vertices: " << tria.n_vertices() << std::endl;
+  deallog << "area: " << area << std::endl;
+  deallog << "faces with boundary id 7: " << n_boundary_faces << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  test(60);
+}
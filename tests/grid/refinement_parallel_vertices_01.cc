@@ -0,0 +1,76 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that the new vertices on a curved mesh, which are computed in
+// parallel during refinement, do not depend on the number of threads.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+std::vector<Point<dim>>
+refine_and_get_vertices(const unsigned int n_threads)
+{
+  MultithreadInfo::set_thread_limit(n_threads);
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(2);
+
+  // refine the cells in the first quadrant once more
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] > 0 && cell->center()[1] > 0)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  deallog << "n_threads=" << n_threads
+          << " n_active_cells=" << tria.n_active_cells() << std::endl;
+
+  return tria.get_vertices();
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  const std::vector<Point<dim>> serial   = refine_and_get_vertices<dim>(1);
+  const std::vector<Point<dim>> threaded = refine_and_get_vertices<dim>(4);
+
+  AssertDimension(serial.size(), threaded.size());
+  for (unsigned int v = 0; v < serial.size(); ++v)
+    AssertThrow(serial[v] == threaded[v], ExcInternalError());
+
+  deallog << "OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+
+  MultithreadInfo::set_thread_limit(testing_max_num_threads());
+}
@@ -0,0 +1,112 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check that vectors that are reinitialized from another vector with
+// omit_zeroing_entries=true, in particular temporary vectors taken from
+// GrowingVectorMemory, zero newly allocated memory, keep the entries of
+// memory that is reused, and share the loop partitioner with the other vector
+// when they are large enough to be worked on by several threads.
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+#include <deal.II/lac/vector_memory.h>
+
+#include "../tests.h"
+
+
+template <typename VectorType>
+void
+check_reinit(const VectorType &v, VectorType &w, const std::string &name)
+{
+  const typename VectorType::value_type *old_data = w.begin();
+  const std::vector<typename VectorType::value_type> old_values(w.begin(),
+                                                                w.end());
+  w.reinit(v, true);
+
+  const bool memory_is_reused = (w.size() > 0 && w.begin() == old_data);
+  bool       entries_are_ok   = true;
+  for (unsigned int i = 0; i < w.size(); ++i)
+    if (memory_is_reused ?
+          (i < old_values.size() && w(i) != old_values[i]) :
+          (w(i) != 0.))
+      entries_are_ok = false;
+
+  deallog << name << ": size " << w.size() << ", "
+          << (memory_is_reused ? "entries kept " : "entries zero ")
+          << (entries_are_ok ? "OK" : "wrong") << ", partitioner "
+          << (w.get_thread_loop_partitioner() != nullptr &&
+                  w.get_thread_loop_partitioner() ==
+                    v.get_thread_loop_partitioner() ?
+                "shared" :
+                "not shared")
+          << std::endl;
+}
+
+
+
+template <typename VectorType>
+void
+do_test(VectorType &v)
+{
+  for (unsigned int i = 0; i < v.size(); ++i)
+    v(i) = i % 7;
+
+  // an empty vector, a vector of a different size, and a vector of the same
+  // size holding other values
+  VectorType w;
+  check_reinit(v, w, "empty vector");
+
+  VectorType u(v.size() / 2);
+  u = 1.;
+  check_reinit(v, u, "smaller vector");
+
+  w = 2.;
+  check_reinit(v, w, "vector of same size");
+
+  // vectors from the pool: the first one is newly allocated, the second one
+  // reuses the memory of the first one
+  GrowingVectorMemory<VectorType> memory;
+  for (unsigned int cycle = 0; cycle < 2; ++cycle)
+    {
+      typename VectorMemory<VectorType>::Pointer tmp(memory);
+      check_reinit(v, *tmp, "pool vector");
+
+      *tmp = v;
+      tmp->add(2., v);
+      deallog << "add: " << tmp->l1_norm() << ' ' << 3. * v.l1_norm()
+              << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(
+    argc, argv, testing_max_num_threads());
+
+  initlog();
+
+  const unsigned int size = 100000;
+
+  Vector<double> v(size);
+  do_test(v);
+
+  LinearAlgebra::distributed::Vector<double> w(size);
+  do_test(w);
+}
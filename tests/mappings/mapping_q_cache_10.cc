@@ -0,0 +1,99 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test MappingQCache::transform_real_to_unit_cell() and
+// MappingQCache::transform_points_real_to_unit_cell(), which use the cached
+// approximation of the inverse mapping, by comparison with MappingQ
+
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/fe/mapping_q_cache.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+template <int dim>
+void
+do_test(const unsigned int degree)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1.);
+  tria.refine_global(1);
+
+  MappingQ<dim>      mapping(degree);
+  MappingQCache<dim> mapping_cache(degree);
+  mapping_cache.initialize(mapping, tria);
+
+  std::vector<Point<dim>> unit_points;
+  for (unsigned int i = 0; i < 7; ++i)
+    {
+      Point<dim> p;
+      for (unsigned int d = 0; d < dim; ++d)
+        p[d] = 0.05 + 0.9 * std::fmod(0.31 * (i + 1) * (d + 1), 1.);
+      unit_points.push_back(p);
+    }
+
+  double max_error_single = 0., max_error_batch = 0., max_error_ref = 0.;
+  std::vector<Point<dim>> real_points(unit_points.size());
+  std::vector<Point<dim>> unit_points_cache(unit_points.size());
+  std::vector<Point<dim>> unit_points_ref(unit_points.size());
+  for (const auto &cell : tria.active_cell_iterators())
+    {
+      for (unsigned int i = 0; i < unit_points.size(); ++i)
+        real_points[i] =
+          mapping.transform_unit_to_real_cell(cell, unit_points[i]);
+
+      for (unsigned int i = 0; i < unit_points.size(); ++i)
+        max_error_single =
+          std::max(max_error_single,
+                   unit_points[i].distance(
+                     mapping_cache.transform_real_to_unit_cell(
+                       cell, real_points[i])));
+
+      mapping_cache.transform_points_real_to_unit_cell(cell,
+                                                       real_points,
+                                                       unit_points_cache);
+      mapping.transform_points_real_to_unit_cell(cell,
+                                                 real_points,
+                                                 unit_points_ref);
+      for (unsigned int i = 0; i < unit_points.size(); ++i)
+        {
+          max_error_batch =
+            std::max(max_error_batch,
+                     unit_points[i].distance(unit_points_cache[i]));
+          max_error_ref = std::max(max_error_ref,
+                                   unit_points_ref[i].distance(
+                                     unit_points_cache[i]));
+        }
+    }
+
+  deallog << "Testing degree " << degree << " in " << dim << "D: "
+          << (max_error_single < 1e-10 ? "OK" : "FAILED") << ' '
+          << (max_error_batch < 1e-10 ? "OK" : "FAILED") << ' '
+          << (max_error_ref < 1e-10 ? "OK" : "FAILED") << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+  do_test<2>(1);
+  do_test<2>(3);
+  do_test<2>(4);
+  do_test<3>(1);
+  do_test<3>(2);
+  do_test<3>(3);
+}
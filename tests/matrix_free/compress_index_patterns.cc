@@ -0,0 +1,171 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test MatrixFree::AdditionalData::compress_cell_index_patterns on a
+// structured mesh: all interleaved cell batches should be converted into
+// either shared patterns or 16 bit offsets, the memory of the indices should
+// go down, and the result of a mass matrix operator must be the same as
+// without compression
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, int fe_degree, typename VectorizedArrayType>
+void
+mass_operator(
+  const MatrixFree<dim, double, VectorizedArrayType> &data,
+  LinearAlgebra::distributed::Vector<double>         &dst,
+  const LinearAlgebra::distributed::Vector<double>   &src,
+  const std::pair<unsigned int, unsigned int>        &cell_range)
+{
+  FEEvaluation<dim, fe_degree, fe_degree + 1, 1, double, VectorizedArrayType>
+    phi(data);
+  for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      phi.reinit(cell);
+      phi.read_dof_values(src);
+      phi.evaluate(EvaluationFlags::values);
+      for (const unsigned int q : phi.quadrature_point_indices())
+        phi.submit_value(phi.get_value(q), q);
+      phi.integrate(EvaluationFlags::values);
+      phi.distribute_local_to_global(dst);
+    }
+}
+
+
+
+template <int dim, int fe_degree, typename VectorizedArrayType>
+void
+test()
+{
+  using DoFInfo = internal::MatrixFreeFunctions::DoFInfo;
+
+  Triangulation<dim>        tria;
+  std::vector<unsigned int> subdivisions(dim, 12);
+  GridGenerator::subdivided_hyper_rectangle(tria,
+                                            subdivisions,
+                                            Point<dim>(),
+                                            Point<dim>::unit_vector(0) +
+                                              (dim > 1 ?
+                                                 Point<dim>::unit_vector(1) :
+                                                 Point<dim>()) +
+                                              (dim > 2 ?
+                                                 Point<dim>::unit_vector(2) :
+                                                 Point<dim>()));
+
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof(tria);
+  dof.distribute_dofs(fe);
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  using MF = MatrixFree<dim, double, VectorizedArrayType>;
+  typename MF::AdditionalData data;
+  data.tasks_parallel_scheme = MF::AdditionalData::none;
+
+  MF mf_plain;
+  mf_plain.reinit(
+    MappingQ1<dim>(), dof, constraints, QGauss<1>(fe_degree + 1), data);
+
+  data.compress_cell_index_patterns = true;
+  MF mf_pattern;
+  mf_pattern.reinit(
+    MappingQ1<dim>(), dof, constraints, QGauss<1>(fe_degree + 1), data);
+
+  const auto count_batches = [](const MF                          &mf,
+                                const DoFInfo::IndexStorageVariants variant) {
+    const auto &variants =
+      mf.get_dof_info().index_storage_variants[DoFInfo::dof_access_cell];
+    return std::count(variants.begin(), variants.end(), variant);
+  };
+
+  LinearAlgebra::distributed::Vector<double> src, dst_plain, dst_pattern;
+  mf_plain.initialize_dof_vector(src);
+  mf_plain.initialize_dof_vector(dst_plain);
+  mf_pattern.initialize_dof_vector(dst_pattern);
+  for (unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    src.local_element(i) = random_value<double>();
+
+  mf_plain.cell_loop(&mass_operator<dim, fe_degree, VectorizedArrayType>,
+                     dst_plain,
+                     src,
+                     true);
+  mf_pattern.cell_loop(&mass_operator<dim, fe_degree, VectorizedArrayType>,
+                       dst_pattern,
+                       src,
+                       true);
+  dst_pattern -= dst_plain;
+
+  deallog << "Testing " << fe.get_name() << " with "
+          << VectorizedArrayType::size() << " lanes" << std::endl;
+  deallog << "Interleaved batches without compression: "
+          << count_batches(mf_plain, DoFInfo::IndexStorageVariants::interleaved)
+          << std::endl;
+  deallog << "Batches with compression: interleaved "
+          << count_batches(mf_pattern,
+                           DoFInfo::IndexStorageVariants::interleaved)
+          << ", pattern "
+          << count_batches(mf_pattern,
+                           DoFInfo::IndexStorageVariants::interleaved_pattern)
+          << ", delta "
+          << count_batches(mf_pattern,
+                           DoFInfo::IndexStorageVariants::interleaved_delta)
+          << std::endl;
+  deallog << "Unique patterns: "
+          << mf_pattern.get_dof_info().dof_indices_patterns.size() /
+               fe.n_dofs_per_cell()
+          << std::endl;
+  deallog << "DoFInfo memory without/with compression: "
+          << mf_plain.get_dof_info().memory_consumption() << " / "
+          << mf_pattern.get_dof_info().memory_consumption() << std::endl;
+  deallog << "Error: "
+          << (dst_pattern.linfty_norm() < 1e-12 * dst_plain.linfty_norm() ?
+                "OK" :
+                "FAILED")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 2, VectorizedArray<double, 1>>();
+  test<2, 3, VectorizedArray<double, 1>>();
+  test<3, 2, VectorizedArray<double, 1>>();
+#if DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 128
+  test<2, 2, VectorizedArray<double, 2>>();
+  test<2, 3, VectorizedArray<double, 2>>();
+  test<3, 2, VectorizedArray<double, 2>>();
+#endif
+}
@@ -0,0 +1,131 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test MatrixFree::AdditionalData::compute_cell_mapping_on_the_fly by
+// comparing the inverse Jacobians and JxW values computed on the fly in
+// FEEvaluation::reinit() on a curved mesh with the precomputed ones, and check
+// that less memory is used for the mapping data
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test(const unsigned int mapping_degree)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1., 0, true);
+  tria.refine_global(4 - dim);
+
+  FE_Q<dim>       fe(3);
+  DoFHandler<dim> dof(tria);
+  dof.distribute_dofs(fe);
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  const MappingQ<dim> mapping(mapping_degree);
+
+  typename MatrixFree<dim>::AdditionalData data;
+  data.tasks_parallel_scheme = MatrixFree<dim>::AdditionalData::none;
+  data.mapping_update_flags  = update_gradients | update_JxW_values;
+
+  MatrixFree<dim> mf_stored;
+  mf_stored.reinit(mapping,
+                   dof,
+                   constraints,
+                   std::vector<QGauss<1>>{QGauss<1>(4), QGauss<1>(6)},
+                   data);
+
+  data.compute_cell_mapping_on_the_fly = true;
+  MatrixFree<dim> mf_on_the_fly;
+  mf_on_the_fly.reinit(mapping,
+                       dof,
+                       constraints,
+                       std::vector<QGauss<1>>{QGauss<1>(4), QGauss<1>(6)},
+                       data);
+
+  AssertThrow(mf_on_the_fly.get_mapping_info().cell_data_on_the_fly,
+              ExcInternalError());
+
+  double max_error_jac = 0., max_error_jxw = 0.;
+  for (unsigned int quad_no = 0; quad_no < 2; ++quad_no)
+    {
+      FEEvaluation<dim, -1> eval_stored(mf_stored, 0, quad_no);
+      FEEvaluation<dim, -1> eval_on_the_fly(mf_on_the_fly, 0, quad_no);
+      for (unsigned int cell = 0; cell < mf_stored.n_cell_batches(); ++cell)
+        {
+          eval_stored.reinit(cell);
+          eval_on_the_fly.reinit(cell);
+          for (const unsigned int q : eval_stored.quadrature_point_indices())
+            for (unsigned int v = 0;
+                 v < mf_stored.n_active_entries_per_cell_batch(cell);
+                 ++v)
+              {
+                max_error_jxw =
+                  std::max(max_error_jxw,
+                           std::abs(eval_stored.JxW(q)[v] -
+                                    eval_on_the_fly.JxW(q)[v]) /
+                             eval_stored.JxW(q)[v]);
+                const auto jac_stored = eval_stored.inverse_jacobian(q);
+                const auto jac_fly    = eval_on_the_fly.inverse_jacobian(q);
+                for (unsigned int d = 0; d < dim; ++d)
+                  for (unsigned int e = 0; e < dim; ++e)
+                    max_error_jac =
+                      std::max(max_error_jac,
+                               std::abs(jac_stored[d][e][v] -
+                                        jac_fly[d][e][v]));
+              }
+        }
+    }
+
+  deallog << "Mapping degree " << mapping_degree << " in " << dim << "D: "
+          << (max_error_jac < 1e-10 && max_error_jxw < 1e-10 ? "OK" :
+                                                               "FAILED")
+          << std::endl;
+  deallog << "Memory reduced: "
+          << (mf_on_the_fly.get_mapping_info().memory_consumption() <
+                  mf_stored.get_mapping_info().memory_consumption() ?
+                "yes" :
+                "no")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(2);
+  test<2>(4);
+  test<3>(2);
+  test<3>(3);
+}
@@ -0,0 +1,142 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check FEMultiCellPointEvaluation, which packs points of several cells into
+// the lanes of VectorizedArray, by comparing to FEPointEvaluation on each
+// cell with a varying number of points per cell
+
+#include <deal.II/base/function_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_multi_cell_point_evaluation.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include <iostream>
+
+#include "../tests.h"
+
+
+
+template <int n_components, int dim>
+void
+test(const unsigned int degree)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1, 6);
+
+  MappingQ<dim> mapping(1);
+
+  FESystem<dim>   fe(FE_Q<dim>(degree), n_components);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  Vector<double> vector(dof_handler.n_dofs());
+  VectorTools::interpolate(mapping,
+                           dof_handler,
+                           Functions::CosineFunction<dim>(n_components),
+                           vector);
+
+  // give the cells between zero and four points
+  std::vector<typename DoFHandler<dim>::active_cell_iterator> cells;
+  std::vector<std::vector<Point<dim>>>                         unit_points;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      std::vector<Point<dim>> points;
+      for (unsigned int i = 0; i < cell->active_cell_index() % 5; ++i)
+        {
+          Point<dim> p;
+          for (unsigned int d = 0; d < dim; ++d)
+            p[d] = static_cast<double>(i + 1) / 7. + 0.0625 * d;
+          points.push_back(p);
+        }
+      cells.push_back(cell);
+      unit_points.push_back(points);
+    }
+
+  FEMultiCellPointEvaluation<n_components, dim> evaluator(
+    fe, update_values | update_gradients);
+  evaluator.reinit(cells, unit_points);
+  evaluator.evaluate(vector,
+                     EvaluationFlags::values | EvaluationFlags::gradients);
+
+  FEPointEvaluation<n_components, dim> reference(mapping,
+                                                 fe,
+                                                 update_values |
+                                                   update_gradients);
+  std::vector<double> solution_values(fe.n_dofs_per_cell());
+
+  unsigned int n_points       = 0;
+  double       error_values   = 0;
+  double       error_gradient = 0;
+  for (unsigned int c = 0; c < evaluator.n_cells(); ++c)
+    {
+      if (evaluator.n_points(c) == 0)
+        continue;
+
+      cells[c]->get_dof_values(vector,
+                               solution_values.begin(),
+                               solution_values.end());
+      reference.reinit(cells[c], unit_points[c]);
+      reference.evaluate(solution_values,
+                         EvaluationFlags::values | EvaluationFlags::gradients);
+
+      for (unsigned int q = 0; q < evaluator.n_points(c); ++q, ++n_points)
+        {
+          error_values =
+            std::max(error_values,
+                     std::abs(static_cast<double>(
+                       (evaluator.get_value(c, q) - reference.get_value(q)) *
+                       (evaluator.get_value(c, q) - reference.get_value(q)))));
+          error_gradient = std::max(error_gradient,
+                                    (evaluator.get_gradient(c, q) -
+                                     reference.get_gradient(q))
+                                      .norm());
+        }
+    }
+
+  deallog << "dim=" << dim << " n_components=" << n_components
+          << " degree=" << degree << ": evaluated " << n_points
+          << " points on " << evaluator.n_cells() << " cells, values "
+          << (std::sqrt(error_values) < 1e-12 ? "OK" : "wrong")
+          << ", gradients " << (error_gradient < 1e-10 ? "OK" : "wrong")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<1, 2>(1);
+  test<1, 2>(3);
+  test<2, 2>(2);
+  test<1, 3>(1);
+  test<1, 3>(2);
+  test<3, 3>(2);
+}
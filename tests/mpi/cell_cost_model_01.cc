@@ -0,0 +1,76 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test parallel::CellCostModel: record artificial costs that are four times
+// higher in the lower half of the domain, which initially is owned by the
+// first process, and check that repartitioning with the predicted costs
+// balances the load. A category without measurements is assumed to be as
+// expensive as the cheapest measured one.
+
+#include <deal.II/distributed/cell_cost_model.h>
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test()
+{
+  parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(4);
+
+  parallel::CellCostModel<dim> cost_model(
+    tria, [](const typename Triangulation<dim>::cell_iterator &cell) {
+      return cell->center()[1] < 0.5 ? 1 : 0;
+    });
+
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      cost_model.record_cell_cost(cell, cell->center()[1] < 0.5 ? 0.4 : 0.1);
+  cost_model.update();
+
+  deallog << "cost of category 0: " << cost_model.get_category_cost(0)
+          << std::endl;
+  deallog << "cost of category 1: " << cost_model.get_category_cost(1)
+          << std::endl;
+  deallog << "cost of unmeasured category 2: "
+          << cost_model.get_category_cost(2) << std::endl;
+  deallog << "imbalance: " << cost_model.predicted_imbalance() << std::endl;
+  deallog << "needs repartitioning: "
+          << cost_model.needs_repartitioning(1.0, 10) << std::endl;
+
+  tria.repartition();
+
+  deallog << "balanced after repartitioning: "
+          << (cost_model.predicted_imbalance() < 0.05) << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test<2>();
+}
@@ -0,0 +1,76 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test DataOutInterface::compute_field_statistics() on a distributed mesh
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/data_out.h>
+
+#include "../tests.h"
+
+
+
+void
+test()
+{
+  parallel::distributed::Triangulation<2> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+
+  Vector<double> x(tria.n_active_cells());
+  Vector<double> one(tria.n_active_cells());
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      {
+        x[cell->active_cell_index()]   = cell->center()[0];
+        one[cell->active_cell_index()] = 1.;
+      }
+
+  DataOut<2> data_out;
+  data_out.attach_triangulation(tria);
+  data_out.add_data_vector(x, "x", DataOut<2>::type_cell_data);
+  data_out.add_data_vector(one, "one", DataOut<2>::type_cell_data);
+  data_out.build_patches();
+
+  for (const auto &statistics :
+       data_out.compute_field_statistics(4, MPI_COMM_WORLD))
+    {
+      deallog << statistics.name << ": n_points=" << statistics.n_points
+              << " min=" << statistics.min_value
+              << " max=" << statistics.max_value
+              << " mean=" << statistics.mean_value << " histogram=";
+      for (const auto count : statistics.histogram)
+        deallog << count << ' ';
+      deallog << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test();
+}
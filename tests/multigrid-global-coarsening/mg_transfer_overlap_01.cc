@@ -0,0 +1,190 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+/**
+ * Test MGTwoLevelTransfer::set_overlap_communication_computation(): the
+ * results of prolongation and restriction must agree with the ones obtained
+ * without overlapping communication and computation, both for transfer
+ * operators with internal vectors and with in-place vectors. Also check
+ * that the cell batches are really split into two groups: with a continuous
+ * coarse space, there are batches that only access locally owned coarse
+ * entries and batches that access ghost entries. A discontinuous coarse
+ * space on the same mesh does not have any ghost accesses.
+ */
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+#include "mg_transfer_util.h"
+
+using namespace dealii;
+
+template <int dim, typename Number>
+void
+do_test(const FiniteElement<dim> &fe_fine,
+        const FiniteElement<dim> &fe_coarse,
+        const bool                inplace)
+{
+  parallel::shared::Triangulation<dim> tria(
+    MPI_COMM_WORLD,
+    ::Triangulation<dim>::none,
+    true,
+    parallel::shared::Triangulation<dim>::partition_custom_signal);
+
+  tria.signals.post_refinement.connect([&]() {
+    GridTools::partition_triangulation_zorder(
+      Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD), tria);
+  });
+
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+  for (auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] < 0.5)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dof_handler_fine(tria);
+  dof_handler_fine.distribute_dofs(fe_fine);
+
+  DoFHandler<dim> dof_handler_coarse(tria);
+  dof_handler_coarse.distribute_dofs(fe_coarse);
+
+  AffineConstraints<Number> constraint_fine(
+    dof_handler_fine.locally_owned_dofs(),
+    DoFTools::extract_locally_relevant_dofs(dof_handler_fine));
+  DoFTools::make_hanging_node_constraints(dof_handler_fine, constraint_fine);
+  constraint_fine.close();
+
+  AffineConstraints<Number> constraint_coarse(
+    dof_handler_coarse.locally_owned_dofs(),
+    DoFTools::extract_locally_relevant_dofs(dof_handler_coarse));
+  DoFTools::make_hanging_node_constraints(dof_handler_coarse,
+                                          constraint_coarse);
+  constraint_coarse.close();
+
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  MGTwoLevelTransfer<dim, VectorType> transfer_ref, transfer;
+  transfer_ref.reinit(dof_handler_fine,
+                      dof_handler_coarse,
+                      constraint_fine,
+                      constraint_coarse);
+  transfer.reinit(dof_handler_fine,
+                  dof_handler_coarse,
+                  constraint_fine,
+                  constraint_coarse);
+  transfer.set_overlap_communication_computation(true);
+
+  VectorType vec_fine, vec_coarse;
+  initialize_dof_vector(vec_fine,
+                        dof_handler_fine,
+                        numbers::invalid_unsigned_int);
+  initialize_dof_vector(vec_coarse,
+                        dof_handler_coarse,
+                        numbers::invalid_unsigned_int);
+
+  if (inplace)
+    {
+      transfer_ref.enable_inplace_operations_if_possible(
+        vec_coarse.get_partitioner(), vec_fine.get_partitioner());
+      transfer.enable_inplace_operations_if_possible(
+        vec_coarse.get_partitioner(), vec_fine.get_partitioner());
+    }
+
+  // the number of batches depends on the SIMD width, so only print whether
+  // the groups are non-empty on some process
+  const std::pair<unsigned int, unsigned int> n_batches =
+    transfer.n_overlap_cell_batches();
+  deallog << "batches with locally owned coarse entries only: "
+          << (Utilities::MPI::sum(n_batches.first, MPI_COMM_WORLD) > 0 ? "yes" :
+                                                                         "no")
+          << std::endl;
+  deallog << "batches with ghost coarse entries: "
+          << (Utilities::MPI::sum(n_batches.second, MPI_COMM_WORLD) > 0 ?
+                "yes" :
+                "no")
+          << std::endl;
+
+  // prolongation
+  {
+    VectorType src(vec_coarse), dst_ref(vec_fine), dst(vec_fine);
+    for (const auto i : src.locally_owned_elements())
+      src[i] = 1. + 0.25 * (i % 7);
+
+    transfer_ref.prolongate_and_add(dst_ref, src);
+    transfer.prolongate_and_add(dst, src);
+
+    dst -= dst_ref;
+    const bool is_same = dst.linfty_norm() < 1e-12 * dst_ref.linfty_norm();
+    deallog << "prolongation " << (is_same ? "OK" : "FAILED") << std::endl;
+  }
+
+  // restriction
+  {
+    VectorType src(vec_fine), dst_ref(vec_coarse), dst(vec_coarse);
+    for (const auto i : src.locally_owned_elements())
+      src[i] = 1. + 0.25 * (i % 5);
+
+    transfer_ref.restrict_and_add(dst_ref, src);
+    transfer.restrict_and_add(dst, src);
+
+    dst -= dst_ref;
+    const bool is_same = dst.linfty_norm() < 1e-12 * dst_ref.linfty_norm();
+    deallog << "restriction " << (is_same ? "OK" : "FAILED") << std::endl;
+  }
+}
+
+template <int dim, typename Number>
+void
+test(const bool inplace)
+{
+  deallog.push(inplace ? "inplace" : "internal");
+
+  deallog.push("CG(2)<->CG(1)");
+  do_test<dim, Number>(FE_Q<dim>(2), FE_Q<dim>(1), inplace);
+  deallog.pop();
+
+  deallog.push("DG(2)<->CG(2)");
+  do_test<dim, Number>(FE_DGQ<dim>(2), FE_Q<dim>(2), inplace);
+  deallog.pop();
+
+  deallog.push("DG(3)<->DG(1)");
+  do_test<dim, Number>(FE_DGQ<dim>(3), FE_DGQ<dim>(1), inplace);
+  deallog.pop();
+
+  deallog.pop();
+}
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test<2, double>(false);
+  test<2, double>(true);
+}
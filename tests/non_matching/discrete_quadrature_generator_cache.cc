@@ -0,0 +1,125 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test DiscreteQuadratureGenerator::set_cache_tolerance(): Quadrature rules
+// are reused if the level set function changes by less than the tolerance,
+// and are otherwise the same as the ones created without reuse.
+
+#include <deal.II/base/function_signed_distance.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/non_matching/quadrature_generator.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+bool
+is_equal(const Quadrature<dim> &q1, const Quadrature<dim> &q2)
+{
+  if (q1.size() != q2.size())
+    return false;
+  for (unsigned int q = 0; q < q1.size(); ++q)
+    if (q1.point(q) != q2.point(q) || q1.weight(q) != q2.weight(q))
+      return false;
+  return true;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  deallog << "dim = " << dim << std::endl;
+
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation, -1, 1);
+  triangulation.refine_global(2);
+
+  hp::FECollection<dim> fe_collection(FE_Q<dim>(1));
+  DoFHandler<dim>       dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe_collection);
+
+  const Functions::SignedDistance::Sphere<dim> sphere(Point<dim>(), 0.6);
+  Vector<double> level_set(dof_handler.n_dofs());
+  VectorTools::interpolate(dof_handler, sphere, level_set);
+
+  const hp::QCollection<1> q_collection1D(QGauss<1>(2));
+
+  NonMatching::DiscreteQuadratureGenerator<dim> cached_generator(
+    q_collection1D, dof_handler, level_set);
+  cached_generator.set_cache_tolerance(1e-6);
+  NonMatching::DiscreteQuadratureGenerator<dim> generator(q_collection1D,
+                                                          dof_handler,
+                                                          level_set);
+
+  std::vector<Quadrature<dim>> old_quadratures;
+  for (const auto &cell : triangulation.active_cell_iterators())
+    {
+      cached_generator.generate(cell);
+      old_quadratures.push_back(cached_generator.get_inside_quadrature());
+    }
+
+  // a perturbation below the tolerance reuses all quadratures
+  level_set.add(1e-8);
+  unsigned int n_reused = 0;
+  for (const auto &cell : triangulation.active_cell_iterators())
+    {
+      cached_generator.generate(cell);
+      if (is_equal(cached_generator.get_inside_quadrature(),
+                   old_quadratures[cell->active_cell_index()]))
+        ++n_reused;
+    }
+  deallog << "reused: " << n_reused << " of "
+          << triangulation.n_active_cells() << std::endl;
+
+  // a larger perturbation creates new quadratures, which need to be the
+  // same as without reuse
+  level_set.add(0.15);
+  unsigned int n_matching = 0;
+  for (const auto &cell : triangulation.active_cell_iterators())
+    {
+      cached_generator.generate(cell);
+      generator.generate(cell);
+      if (is_equal(cached_generator.get_inside_quadrature(),
+                   generator.get_inside_quadrature()) &&
+          is_equal(cached_generator.get_outside_quadrature(),
+                   generator.get_outside_quadrature()) &&
+          cached_generator.get_surface_quadrature().size() ==
+            generator.get_surface_quadrature().size())
+        ++n_matching;
+    }
+  deallog << "matching: " << n_matching << " of "
+          << triangulation.n_active_cells() << std::endl;
+  deallog << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  test<2>();
+  test<3>();
+}
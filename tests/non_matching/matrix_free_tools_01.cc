@@ -0,0 +1,176 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test NonMatching::MatrixFreeTools::reinit_intersected_cells(): compute the
+// volume and the surface of a sphere in a loop over the cell batches of a
+// MatrixFree object, using FEEvaluation on the batches inside the sphere and
+// FEPointEvaluation on the batches of intersected cells, and compare to a
+// loop over all cells.
+
+#include <deal.II/base/function_signed_distance.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/non_matching/mapping_info.h>
+#include <deal.II/non_matching/matrix_free_tools.h>
+#include <deal.II/non_matching/mesh_classifier.h>
+#include <deal.II/non_matching/quadrature_generator.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test()
+{
+  deallog << "dim = " << dim << std::endl;
+
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation, -1, 1);
+  triangulation.refine_global(dim == 2 ? 4 : 3);
+
+  const FE_Q<dim> fe(1);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  const Functions::SignedDistance::Sphere<dim> sphere(Point<dim>(), 0.6);
+  Vector<double> level_set(dof_handler.n_dofs());
+  VectorTools::interpolate(dof_handler, sphere, level_set);
+
+  NonMatching::MeshClassifier<dim> classifier(dof_handler, level_set);
+  classifier.reclassify();
+
+  const MappingQ1<dim>                          mapping;
+  const hp::QCollection<1>                      q_collection1D(QGauss<1>(2));
+  NonMatching::DiscreteQuadratureGenerator<dim> quadrature_generator(
+    q_collection1D, dof_handler, level_set);
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.mapping_update_flags = update_JxW_values;
+  data.cell_vectorization_category =
+    classifier.get_cell_vectorization_categories();
+  data.cell_vectorization_categories_strict = true;
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping, dof_handler, constraints, QGauss<1>(2), data);
+
+  NonMatching::MappingInfo<dim> mapping_info_inside(mapping,
+                                                    update_JxW_values);
+  NonMatching::MappingInfo<dim> mapping_info_surface(mapping,
+                                                     update_JxW_values);
+  NonMatching::MatrixFreeTools::reinit_intersected_cells(matrix_free,
+                                                         quadrature_generator,
+                                                         &mapping_info_inside,
+                                                         &mapping_info_surface);
+
+  // integrate over the batches of the MatrixFree object
+  FEEvaluation<dim, 1>      fe_eval(matrix_free);
+  FEPointEvaluation<1, dim> fe_point_inside(mapping_info_inside, fe);
+  FEPointEvaluation<1, dim> fe_point_surface(mapping_info_surface, fe);
+  double                    volume  = 0.;
+  double                    surface = 0.;
+  for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      const auto location = static_cast<NonMatching::LocationToLevelSet>(
+        matrix_free.get_cell_category(cell));
+      if (location == NonMatching::LocationToLevelSet::inside)
+        {
+          fe_eval.reinit(cell);
+          for (const unsigned int q : fe_eval.quadrature_point_indices())
+            for (unsigned int v = 0;
+                 v < matrix_free.n_active_entries_per_cell_batch(cell);
+                 ++v)
+              volume += fe_eval.JxW(q)[v];
+        }
+      else if (location == NonMatching::LocationToLevelSet::intersected)
+        for (unsigned int v = 0;
+             v < matrix_free.n_active_entries_per_cell_batch(cell);
+             ++v)
+          {
+            const unsigned int cell_index =
+              matrix_free.get_cell_iterator(cell, v)->active_cell_index();
+
+            fe_point_inside.reinit(cell_index);
+            for (const unsigned int q :
+                 fe_point_inside.quadrature_point_indices())
+              volume += fe_point_inside.JxW(q);
+
+            fe_point_surface.reinit(cell_index);
+            for (const unsigned int q :
+                 fe_point_surface.quadrature_point_indices())
+              surface += fe_point_surface.JxW(q);
+          }
+    }
+
+  // integrate with a loop over all cells, using that the cells are squares
+  // or cubes
+  double volume_ref  = 0.;
+  double surface_ref = 0.;
+  for (const auto &cell : triangulation.active_cell_iterators())
+    {
+      const NonMatching::LocationToLevelSet location =
+        classifier.location_to_level_set(cell);
+      if (location == NonMatching::LocationToLevelSet::inside)
+        volume_ref += cell->measure();
+      else if (location == NonMatching::LocationToLevelSet::intersected)
+        {
+          quadrature_generator.generate(cell);
+          for (const double w :
+               quadrature_generator.get_inside_quadrature().get_weights())
+            volume_ref += w * cell->measure();
+          for (const double w :
+               quadrature_generator.get_surface_quadrature().get_weights())
+            surface_ref += w * cell->measure() / cell->extent_in_direction(0);
+        }
+    }
+
+  deallog << "volume: " << volume << ", surface: " << surface << std::endl;
+  deallog << "matches loop over cells: "
+          << (std::abs(volume - volume_ref) < 1e-12 &&
+                  std::abs(surface - surface_ref) < 1e-12 ?
+                "yes" :
+                "no")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  test<2>();
+  test<3>();
+}
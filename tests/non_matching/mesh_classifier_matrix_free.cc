@@ -0,0 +1,107 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test MeshClassifier::get_cell_vectorization_categories(): when passed to
+// MatrixFree, all cells of a cell batch have the same location relative to
+// the level set function, which is returned as the category of the batch.
+
+#include <deal.II/base/function_signed_distance.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/non_matching/mesh_classifier.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test()
+{
+  deallog << "dim = " << dim << std::endl;
+
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation, -1, 1);
+  triangulation.refine_global(dim == 2 ? 3 : 2);
+
+  const FE_Q<dim> fe(1);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  const Functions::SignedDistance::Sphere<dim> sphere(Point<dim>(), 0.6);
+  Vector<double> level_set(dof_handler.n_dofs());
+  VectorTools::interpolate(dof_handler, sphere, level_set);
+
+  NonMatching::MeshClassifier<dim> classifier(dof_handler, level_set);
+  classifier.reclassify();
+
+  typename MatrixFree<dim, double>::AdditionalData data;
+  data.cell_vectorization_category =
+    classifier.get_cell_vectorization_categories();
+  data.cell_vectorization_categories_strict = true;
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    MappingQ1<dim>(), dof_handler, constraints, QGauss<1>(2), data);
+
+  std::array<unsigned int, 3> n_cells       = {{0, 0, 0}};
+  bool                        is_consistent = true;
+  for (unsigned int batch = 0; batch < matrix_free.n_cell_batches(); ++batch)
+    {
+      const auto location = static_cast<NonMatching::LocationToLevelSet>(
+        matrix_free.get_cell_category(batch));
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_cell_batch(batch);
+           ++v)
+        {
+          if (classifier.location_to_level_set(
+                matrix_free.get_cell_iterator(batch, v)) != location)
+            is_consistent = false;
+          ++n_cells[static_cast<unsigned int>(location)];
+        }
+    }
+
+  deallog << "inside: " << n_cells[0] << ", outside: " << n_cells[1]
+          << ", intersected: " << n_cells[2] << std::endl;
+  deallog << "consistent: " << (is_consistent ? "yes" : "no") << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,79 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test ParameterHandler::parse_input() with an MPI communicator, where only
+// the root process reads the file, and check that the converted values
+// returned by get_integer(), get_double(), and get_bool() are updated when
+// a parameter is set again.
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parameter_handler.h>
+
+#include "../tests.h"
+
+void
+test()
+{
+  ParameterHandler prm;
+  prm.enter_subsection("Geometry");
+  prm.declare_entry("dim", "1", Patterns::Integer());
+  prm.declare_entry("Scaling", "1.0", Patterns::Double());
+  prm.leave_subsection();
+  prm.declare_entry("Output", "false", Patterns::Bool());
+
+  unsigned int n_actions = 0;
+  prm.add_action(
+    "Output", [&](const std::string &) { ++n_actions; }, false);
+
+  prm.parse_input(SOURCE_DIR "/parameter_handler_30_in.prm", MPI_COMM_WORLD);
+
+  for (unsigned int i = 0; i < 2; ++i)
+    {
+      prm.enter_subsection("Geometry");
+      deallog << "dim = " << prm.get_integer("dim")
+              << ", scaling = " << prm.get_double("Scaling") << std::endl;
+      prm.leave_subsection();
+      deallog << "output = " << prm.get_bool("Output")
+              << ", actions = " << n_actions << std::endl;
+    }
+
+  prm.enter_subsection("Geometry");
+  prm.set("dim", "2");
+  prm.leave_subsection();
+  prm.set("Output", "false");
+  deallog << "dim = " << prm.get_integer({"Geometry"}, "dim")
+          << ", output = " << prm.get_bool("Output")
+          << ", actions = " << n_actions << std::endl;
+
+  try
+    {
+      prm.parse_input(SOURCE_DIR "/does_not_exist.prm", MPI_COMM_WORLD);
+    }
+  catch (const std::exception &)
+    {
+      deallog << "Missing file detected" << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test();
+}
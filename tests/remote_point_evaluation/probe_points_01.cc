@@ -0,0 +1,150 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check VectorTools::ProbePoints for a vector-valued field on a shared
+// triangulation by comparing to VectorTools::point_values() and to the
+// interpolated function, which the finite element represents exactly. Some
+// of the points lie on vertices and are thus found in several cells.
+
+#include <deal.II/base/function.h>
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/numerics/vector_tools.h>
+#include <deal.II/numerics/vector_tools_evaluate.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+class QuadraticFunction : public Function<dim>
+{
+public:
+  QuadraticFunction(const double factor)
+    : Function<dim>(2)
+    , factor(factor)
+  {}
+
+  virtual double
+  value(const Point<dim> &p, const unsigned int component) const override
+  {
+    if (component == 0)
+      return factor * (p[0] + 2. * p[dim - 1]);
+    else
+      return factor * p[0] * p[dim - 1];
+  }
+
+private:
+  const double factor;
+};
+
+
+
+template <int dim>
+void
+test()
+{
+  parallel::shared::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+
+  const MappingQ1<dim> mapping;
+  const FESystem<dim>  fe(FE_Q<dim>(2), 2);
+  DoFHandler<dim>      dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  LinearAlgebra::distributed::Vector<double> vector(
+    dof_handler.locally_owned_dofs(),
+    DoFTools::extract_locally_relevant_dofs(dof_handler),
+    MPI_COMM_WORLD);
+
+  // points in the interior of cells and on vertices
+  std::vector<Point<dim>> points;
+  for (unsigned int i = 0; i < 7; ++i)
+    {
+      Point<dim> p;
+      for (unsigned int d = 0; d < dim; ++d)
+        p[d] = (i % 2 == 0) ? 0.125 * (i + d) : 0.1 * i + 0.03 * d;
+      points.push_back(p);
+    }
+
+  VectorTools::ProbePoints<2, dim> probes(mapping, dof_handler, points);
+  VectorTools::ProbePoints<1, dim> second_component(mapping,
+                                                    dof_handler,
+                                                    points,
+                                                    1);
+  deallog << "dim=" << dim << " all points found: "
+          << probes.get_remote_point_evaluation().all_points_found()
+          << ", n_points=" << probes.n_points() << std::endl;
+
+  Utilities::MPI::RemotePointEvaluation<dim> cache;
+  for (unsigned int step = 1; step < 3; ++step)
+    {
+      const QuadraticFunction<dim> function(step);
+      VectorTools::interpolate(mapping, dof_handler, function, vector);
+      vector.update_ghost_values();
+
+      const std::vector<Tensor<1, 2>> values = probes.evaluate(vector);
+      const std::vector<Tensor<1, 2>> reference =
+        VectorTools::point_values<2>(
+          mapping, dof_handler, vector, points, cache);
+      const std::vector<double> values_1 = second_component.evaluate(vector);
+
+      double error_reference = 0, error_exact = 0;
+      for (unsigned int i = 0; i < points.size(); ++i)
+        {
+          error_reference =
+            std::max(error_reference, (values[i] - reference[i]).norm());
+          for (unsigned int c = 0; c < 2; ++c)
+            error_exact = std::max(error_exact,
+                                   std::abs(values[i][c] -
+                                            function.value(points[i], c)));
+          error_exact = std::max(error_exact,
+                                 std::abs(values_1[i] -
+                                          function.value(points[i], 1)));
+        }
+
+      deallog << "step " << step << ": difference to point_values() "
+              << (error_reference < 1e-12 ? "OK" : "wrong")
+              << ", difference to function "
+              << (error_exact < 1e-12 ? "OK" : "wrong") << std::endl;
+
+      vector.zero_out_ghost_values();
+    }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  initlog();
+
+  test<2>();
+  test<3>();
+}
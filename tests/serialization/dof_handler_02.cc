@@ -0,0 +1,112 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Save a triangulation and the renumbered degrees of freedom of a
+// DoFHandler into binary files and check that loading them back in restores
+// the same numbering without calling distribute_dofs(). Loading the data
+// into a DoFHandler in hp-mode needs to fail since the file was written
+// without hp-capabilities.
+
+#include <deal.II/dofs/dof_accessor.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  const FE_Q<dim> fe(2);
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+  DoFRenumbering::Cuthill_McKee(dof_handler);
+
+  tria.save("snapshot");
+  dof_handler.save("snapshot_dofs");
+
+  Triangulation<dim> tria_loaded;
+  tria_loaded.load("snapshot");
+
+  DoFHandler<dim> dof_handler_loaded(tria_loaded);
+  dof_handler_loaded.load("snapshot_dofs", fe);
+
+  deallog << "n_active_cells: " << tria_loaded.n_active_cells() << std::endl;
+  deallog << "n_dofs: " << dof_handler_loaded.n_dofs() << std::endl;
+
+  AssertThrow(tria_loaded.n_active_cells() == tria.n_active_cells(),
+              ExcInternalError());
+  AssertThrow(dof_handler_loaded.n_dofs() == dof_handler.n_dofs(),
+              ExcInternalError());
+
+  std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+  std::vector<types::global_dof_index> dof_indices_loaded(
+    fe.n_dofs_per_cell());
+  for (auto cell = dof_handler.begin_active(),
+            cell_loaded = dof_handler_loaded.begin_active();
+       cell != dof_handler.end();
+       ++cell, ++cell_loaded)
+    {
+      AssertThrow(cell->center().distance(cell_loaded->center()) < 1e-12,
+                  ExcInternalError());
+      cell->get_dof_indices(dof_indices);
+      cell_loaded->get_dof_indices(dof_indices_loaded);
+      AssertThrow(dof_indices == dof_indices_loaded, ExcInternalError());
+    }
+
+  deallog << "OK" << std::endl;
+
+  DoFHandler<dim> dof_handler_hp(tria_loaded);
+  try
+    {
+      dof_handler_hp.load("snapshot_dofs",
+                          hp::FECollection<dim>(fe, FE_Q<dim>(1)));
+      deallog << "hp-mode mismatch not detected" << std::endl;
+    }
+  catch (const ExceptionBase &)
+    {
+      deallog << "hp-mode mismatch detected" << std::endl;
+    }
+}
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
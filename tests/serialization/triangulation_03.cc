@@ -0,0 +1,95 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that Triangulation::load() still reads snapshots in the format
+// written before Triangulation::save() switched to binary archives, i.e., a
+// text archive and an .info file without a format entry.
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include <boost/archive/text_oarchive.hpp>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+  tria.begin_active()->face(0)->set_boundary_id(3);
+
+  // write the snapshot the way Triangulation::save() used to do it
+  {
+    std::ofstream                 ofs("snapshot_triangulation.data");
+    boost::archive::text_oarchive oa(ofs, boost::archive::no_header);
+    tria.save(oa, 5);
+  }
+  {
+    std::ofstream ofs("snapshot.info");
+    ofs
+      << "version nproc n_attached_fixed_size_objs n_attached_variable_size_objs n_active_cells"
+      << std::endl
+      << 5 << ' ' << 1 << ' ' << 0 << ' ' << 0 << ' ' << tria.n_active_cells()
+      << std::endl;
+  }
+
+  Triangulation<dim> tria_loaded;
+  tria_loaded.load("snapshot");
+
+  deallog << "n_active_cells: " << tria_loaded.n_active_cells() << std::endl;
+  deallog << "n_cells: " << tria_loaded.n_cells() << std::endl;
+
+  AssertThrow(tria_loaded.n_cells() == tria.n_cells(), ExcInternalError());
+  for (auto cell = tria.begin(), cell_loaded = tria_loaded.begin();
+       cell != tria.end();
+       ++cell, ++cell_loaded)
+    {
+      AssertThrow(cell->level() == cell_loaded->level(), ExcInternalError());
+      AssertThrow(cell->is_active() == cell_loaded->is_active(),
+                  ExcInternalError());
+      for (const unsigned int v : cell->vertex_indices())
+        AssertThrow(cell->vertex(v) == cell_loaded->vertex(v),
+                    ExcInternalError());
+      for (const unsigned int f : cell->face_indices())
+        AssertThrow(cell->face(f)->boundary_id() ==
+                      cell_loaded->face(f)->boundary_id(),
+                    ExcInternalError());
+    }
+
+  deallog << "OK" << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
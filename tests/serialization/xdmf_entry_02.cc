@@ -0,0 +1,84 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check that an XDMFEntry can be loaded from an archive written before the
+// HDF5 group of the solution datasets was added to the class, and that the
+// group survives serialization
+
+#include <deal.II/base/data_out_base.h>
+
+#include "serialization.h"
+
+void
+test()
+{
+  // an XDMFEntry with two attributes, written by version 0 of the class
+  const std::string old_archive =
+    "0 0 1 11 solution.h5 7 mesh.h5 5.00000000000000000e-01 128 16 2 3 0 0 "
+    "3 0 0 2 0 0 0 1 u 1 1 v 3\n";
+
+  {
+    XDMFEntry                     entry;
+    std::istringstream            iss(old_archive);
+    boost::archive::text_iarchive ia(iss, boost::archive::no_header);
+    ia >> entry;
+
+    deallog << "XDMFEntry from old archive: " << std::endl
+            << std::endl
+            << entry.get_xdmf_content(0) << std::endl;
+  }
+
+  XDMFEntry entry1("mesh.h5",
+                   "solution.h5",
+                   0.5,
+                   128,
+                   16,
+                   2,
+                   3,
+                   ReferenceCells::Quadrilateral,
+                   "step_00001");
+  entry1.add_attribute("u", 1);
+  XDMFEntry entry2;
+
+  std::ostringstream oss;
+  {
+    boost::archive::text_oarchive oa(oss, boost::archive::no_header);
+    oa << entry1;
+  }
+  {
+    std::istringstream            iss(oss.str());
+    boost::archive::text_iarchive ia(iss, boost::archive::no_header);
+    ia >> entry2;
+  }
+
+  AssertThrow(entry1.get_xdmf_content(0) == entry2.get_xdmf_content(0),
+              ExcInternalError());
+  deallog << "XDMFEntry with solution group after de-serialization: "
+          << std::endl
+          << std::endl
+          << entry2.get_xdmf_content(0) << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+  deallog << std::setprecision(3);
+
+  test();
+
+  deallog << "OK" << std::endl;
+}
@@ -0,0 +1,159 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check VectorTools::Interpolator and VectorTools::Projector against
+// VectorTools::interpolate() and VectorTools::project() for a
+// time-dependent function on a mesh with hanging nodes
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/vector_tools.h>
+#include <deal.II/numerics/vector_tools_interpolator.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+class TimeDependentFunction : public Function<dim>
+{
+public:
+  TimeDependentFunction(const unsigned int n_components)
+    : Function<dim>(n_components)
+  {}
+
+  virtual double
+  value(const Point<dim> &p, const unsigned int component) const override
+  {
+    return (1. + component) * std::sin(p[0]) +
+           this->get_time() * p[dim - 1] * p[dim - 1] + component;
+  }
+};
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  MappingQ<dim> mapping(2);
+
+  // interpolation of a vector-valued function
+  {
+    FESystem<dim>   fe(FE_Q<dim>(2), 2);
+    DoFHandler<dim> dof_handler(tria);
+    dof_handler.distribute_dofs(fe);
+
+    TimeDependentFunction<dim>     function(2);
+    VectorTools::Interpolator<dim> interpolator(mapping, dof_handler);
+    Vector<double>                 interpolation(dof_handler.n_dofs());
+    Vector<double>                 reference(dof_handler.n_dofs());
+    for (unsigned int step = 0; step < 2; ++step)
+      {
+        function.set_time(0.5 * step);
+        interpolator.interpolate(function, interpolation);
+        VectorTools::interpolate(mapping, dof_handler, function, reference);
+        reference -= interpolation;
+        deallog << "dim=" << dim
+                << " interpolation at t=" << function.get_time() << ": "
+                << (interpolator.n_points() == dof_handler.n_dofs() ? "all" :
+                                                                      "not all")
+                << " dofs, difference "
+                << (reference.linfty_norm() < 1e-12 ? "OK" : "wrong")
+                << std::endl;
+      }
+
+    // only interpolate the second component
+    interpolation = 0.;
+    interpolator.interpolate(function,
+                             interpolation,
+                             ComponentMask(std::vector<bool>{false, true}));
+    unsigned int n_nonzero = 0;
+    for (const double v : interpolation)
+      if (v != 0.)
+        ++n_nonzero;
+    deallog << "dim=" << dim << " masked interpolation: "
+            << (2 * n_nonzero == dof_handler.n_dofs() ? "half" : "wrong")
+            << " of the entries set" << std::endl;
+  }
+
+  // projection of a scalar function
+  {
+    FE_Q<dim>       fe(2);
+    DoFHandler<dim> dof_handler(tria);
+    dof_handler.distribute_dofs(fe);
+
+    AffineConstraints<double> constraints;
+    DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+    constraints.close();
+
+    TimeDependentFunction<dim>  function(1);
+    VectorTools::Projector<dim> projector(mapping,
+                                          dof_handler,
+                                          constraints,
+                                          QGauss<1>(fe.degree + 2));
+    LinearAlgebra::distributed::Vector<double> projection, reference;
+    projector.initialize_dof_vector(projection);
+    projector.initialize_dof_vector(reference);
+    for (unsigned int step = 0; step < 2; ++step)
+      {
+        function.set_time(0.5 * step);
+        projector.project(function, projection);
+        VectorTools::project(mapping,
+                             dof_handler,
+                             constraints,
+                             QGauss<dim>(fe.degree + 2),
+                             function,
+                             reference);
+        reference -= projection;
+        deallog << "dim=" << dim << " projection at t=" << function.get_time()
+                << ": difference "
+                << (reference.linfty_norm() < 1e-8 ? "OK" : "wrong")
+                << std::endl;
+      }
+  }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}